@@ -0,0 +1,10 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AbilitySystem/AG_AbilitySystemGlobals.h"
+
+#include "AbilitySystem/AG_GameplayEffectContext.h"
+
+FGameplayEffectContext* UAG_AbilitySystemGlobals::AllocGameplayEffectContext() const
+{
+	return new FAGGameplayEffectContext();
+}
@@ -0,0 +1,20 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemGlobals.h"
+#include "AG_AbilitySystemGlobals.generated.h"
+
+/**
+ * Ŀ AbilitySystemGlobalsDefaultGame.ini ͨ AbilitySystemGlobalsClassName ָ
+ *  MakeEffectContext  FAGGameplayEffectContext
+ */
+UCLASS()
+class ACTIONGAME_API UAG_AbilitySystemGlobals : public UAbilitySystemGlobals
+{
+	GENERATED_BODY()
+
+public:
+	virtual FGameplayEffectContext* AllocGameplayEffectContext() const override;
+};
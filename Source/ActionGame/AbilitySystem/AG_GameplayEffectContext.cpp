@@ -0,0 +1,214 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AbilitySystem/AG_GameplayEffectContext.h"
+
+#include "ActionGame.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+// ֻƴֽ ActionGame.AbilitySystem.EffectContextBytes Ը
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effect Contexts Sent (Compact)"), STAT_AG_EffectContextCompact, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effect Contexts Sent (Full)"), STAT_AG_EffectContextFull, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarEffectContextCompact(
+	TEXT("ag.EffectContext.Compact"),
+	1,
+	TEXT("Serialize gameplay effect contexts in the compact format (quantized impact, no full FHitResult)\n")
+	TEXT(" 0: engine default format (for bandwidth comparison)\n")
+	TEXT(" 1: compact"),
+	ECVF_Default
+);
+
+FAGGameplayEffectContext* FAGGameplayEffectContext::Get(const FGameplayEffectContextHandle& Handle)
+{
+	const FGameplayEffectContext* BaseContext = Handle.Get();
+	if (BaseContext && BaseContext->GetScriptStruct()->IsChildOf(FAGGameplayEffectContext::StaticStruct()))
+	{
+		// Handle ֻǹָİװContext д
+		return const_cast<FAGGameplayEffectContext*>(static_cast<const FAGGameplayEffectContext*>(BaseContext));
+	}
+	return nullptr;
+}
+
+void FAGGameplayEffectContext::AddHitResult(const FHitResult& InHitResult, bool bReset)
+{
+	Super::AddHitResult(InHitResult, bReset);
+
+	if (GetHitResult() == nullptr)
+	{
+		return;
+	}
+
+	bHasImpact = true;
+	ImpactLocation = InHitResult.ImpactPoint;
+	ImpactNormal = InHitResult.ImpactNormal;
+	SurfaceType = static_cast<uint8>(UPhysicalMaterial::DetermineSurfaceType(InHitResult.PhysMaterial.Get()));
+}
+
+void FAGGameplayEffectContext::AddInstigator(AActor* InInstigator, AActor* InEffectCauser)
+{
+	if (const APlayerState* PlayerState = Cast<APlayerState>(InInstigator))
+	{
+		if (APawn* Pawn = PlayerState->GetPawn())
+		{
+			InInstigator = Pawn;
+		}
+	}
+
+	Super::AddInstigator(InInstigator, InEffectCauser);
+}
+
+FGameplayEffectContext* FAGGameplayEffectContext::Duplicate() const
+{
+	FAGGameplayEffectContext* NewContext = new FAGGameplayEffectContext();
+	*NewContext = *this;
+
+	//  HitResultѹֶ渳ֵٰ PhysMaterial 㣨ͻؽûвʣ
+	if (GetHitResult())
+	{
+		NewContext->Super::AddHitResult(*GetHitResult(), true);
+	}
+	return NewContext;
+}
+
+bool FAGGameplayEffectContext::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 bCompact = 0;
+	if (Ar.IsSaving())
+	{
+		bCompact = CVarEffectContextCompact.GetValueOnAnyThread() != 0 ? 1 : 0;
+	}
+	Ar.SerializeBits(&bCompact, 1);
+
+	bool bBaseOk = true;
+	if (bCompact)
+	{
+		NetSerializeCompact(Ar, Map, bBaseOk);
+	}
+	else
+	{
+		Super::NetSerialize(Ar, Map, bBaseOk);
+	}
+
+	Ar << DamageArchetype;
+
+	if (Ar.IsSaving())
+	{
+		if (bCompact)
+		{
+			INC_DWORD_STAT(STAT_AG_EffectContextCompact);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_AG_EffectContextFull);
+		}
+	}
+
+	bOutSuccess = bBaseOk;
+	return true;
+}
+
+bool FAGGameplayEffectContext::NetSerializeCompact(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	//  FGameplayEffectContext::NetSerialize ֶһ£ֻ HitResult ѹСWorldOrigin 
+	enum ERepBit : uint8
+	{
+		Rep_Instigator		= 1 << 0,
+		Rep_EffectCauser	= 1 << 1,
+		Rep_AbilityCDO		= 1 << 2,
+		Rep_SourceObject	= 1 << 3,
+		Rep_Actors			= 1 << 4,
+		Rep_Impact			= 1 << 5,
+		Rep_WorldOrigin		= 1 << 6,
+	};
+
+	uint8 RepBits = 0;
+	if (Ar.IsSaving())
+	{
+		if (bReplicateInstigator && Instigator.IsValid())		RepBits |= Rep_Instigator;
+		if (bReplicateEffectCauser && EffectCauser.IsValid())	RepBits |= Rep_EffectCauser;
+		if (AbilityCDO.IsValid())								RepBits |= Rep_AbilityCDO;
+		if (bReplicateSourceObject && SourceObject.IsValid())	RepBits |= Rep_SourceObject;
+		if (Actors.Num() > 0)									RepBits |= Rep_Actors;
+		if (bHasImpact)											RepBits |= Rep_Impact;
+		if (bHasWorldOrigin)									RepBits |= Rep_WorldOrigin;
+	}
+
+	Ar.SerializeBits(&RepBits, 7);
+
+	if (RepBits & Rep_Instigator)
+	{
+		Ar << Instigator;
+	}
+	if (RepBits & Rep_EffectCauser)
+	{
+		Ar << EffectCauser;
+	}
+	if (RepBits & Rep_AbilityCDO)
+	{
+		Ar << AbilityCDO;
+	}
+	if (RepBits & Rep_SourceObject)
+	{
+		Ar << SourceObject;
+	}
+	if (RepBits & Rep_Actors)
+	{
+		SafeNetSerializeTArray_Default<31>(Ar, Actors);
+	}
+
+	bool bImpactOk = true;
+	if (RepBits & Rep_Impact)
+	{
+		bool bNormalOk = true;
+		ImpactLocation.NetSerialize(Ar, Map, bImpactOk);
+		ImpactNormal.NetSerialize(Ar, Map, bNormalOk);
+		Ar << SurfaceType;
+		bImpactOk &= bNormalOk;
+
+		if (Ar.IsLoading())
+		{
+			bHasImpact = true;
+
+			// ͻؽУCue  GetHitResult ճãû Actor / Component / PhysMaterial
+			TSharedPtr<FHitResult> Hit = MakeShared<FHitResult>();
+			Hit->bBlockingHit = true;
+			Hit->Location = ImpactLocation;
+			Hit->ImpactPoint = ImpactLocation;
+			Hit->Normal = ImpactNormal;
+			Hit->ImpactNormal = ImpactNormal;
+			HitResult = Hit;
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		bHasImpact = false;
+		HitResult.Reset();
+	}
+
+	if (RepBits & Rep_WorldOrigin)
+	{
+		FVector_NetQuantize QuantizedOrigin = WorldOrigin;
+		bool bOriginOk = true;
+		QuantizedOrigin.NetSerialize(Ar, Map, bOriginOk);
+		if (Ar.IsLoading())
+		{
+			WorldOrigin = QuantizedOrigin;
+		}
+		bHasWorldOrigin = true;
+	}
+	else
+	{
+		bHasWorldOrigin = false;
+	}
+
+	if (Ar.IsLoading())
+	{
+		// ʼ InstigatorAbilitySystemComponent
+		AddInstigator(Instigator.Get(), EffectCauser.Get());
+	}
+
+	bOutSuccess = bImpactOk;
+	return true;
+}
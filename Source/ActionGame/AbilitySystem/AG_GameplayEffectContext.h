@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "Engine/NetSerialization.h"
+#include "ActionGameTypes.h"
+#include "AG_GameplayEffectContext.generated.h"
+
+/**
+ * ActionGame  EffectContext
+ * - Ա FHitResultֻе / ߡ 1 ֽڡ 1 ֽ
+ * - ͻյ⼸ؽһ FHitResultGetHitResult() Ȼ
+ *   ֻе / ߣGetActor() / GetComponent() / PhysMaterial / BoneName ڿͻ˶Ϊգ
+ *   Cue Ҫʱ GetSurfaceType()ҪĿʱ Cue  Target
+ * - ag.EffectContext.Compact 0 ʱĬϸʽлڶԱȴ
+ * ָʽֽ ActionGame.AbilitySystem.EffectContextBytes 
+ *  UAG_AbilitySystemGlobals::AllocGameplayEffectContext 
+ */
+USTRUCT()
+struct ACTIONGAME_API FAGGameplayEffectContext : public FGameplayEffectContext
+{
+	GENERATED_BODY()
+
+public:
+	/** Handle ﲻǱʱؿ */
+	static FAGGameplayEffectContext* Get(const FGameplayEffectContextHandle& Handle);
+
+	virtual void AddHitResult(const FHitResult& InHitResult, bool bReset = false) override;
+
+	/**  ASC  Owner  PlayerStateInstigator Ƶ PawnɱͽCue ԽɫΪ׼ */
+	virtual void AddInstigator(AActor* InInstigator, AActor* InEffectCauser) override;
+
+	void SetDamageArchetype(EAGDamageArchetype InArchetype) { DamageArchetype = InArchetype; }
+	EAGDamageArchetype GetDamageArchetype() const { return DamageArchetype; }
+
+	/** EPhysicalSurface */
+	uint8 GetSurfaceType() const { return SurfaceType; }
+
+	virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
+	virtual FGameplayEffectContext* Duplicate() const override;
+	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+
+protected:
+	/** ֻʱЧ */
+	UPROPERTY()
+	FVector_NetQuantize ImpactLocation;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal ImpactNormal;
+
+	UPROPERTY()
+	uint8 SurfaceType = 0;
+
+	UPROPERTY()
+	EAGDamageArchetype DamageArchetype = EAGDamageArchetype::None;
+
+	UPROPERTY()
+	bool bHasImpact = false;
+
+private:
+	bool NetSerializeCompact(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FAGGameplayEffectContext> : public TStructOpsTypeTraitsBase2<FAGGameplayEffectContext>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true,
+	};
+};
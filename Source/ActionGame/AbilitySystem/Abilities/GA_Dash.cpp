@@ -3,3 +3,54 @@
 
 #include "AbilitySystem/Abilities/GA_Dash.h"
 
+#include "GameFramework/Character.h"
+#include "Abilities/Tasks/AbilityTask_WaitDelay.h"
+#include "ActorComponents/AG_CharacterMovementComponent.h"
+
+UGA_Dash::UGA_Dash()
+{
+	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+}
+
+void UGA_Dash::ActivateAbility(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo,
+	const FGameplayEventData* TriggerEventData
+)
+{
+	// У
+	if (!ActorInfo || !ActorInfo->AvatarActor.IsValid())
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	ACharacter* Character = Cast<ACharacter>(ActorInfo->AvatarActor.Get());
+	UAG_CharacterMovementComponent* MoveComp = Character ? Cast<UAG_CharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+	if (!MoveComp)
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	// /ȴ
+	if (!CommitAbilityChecked())
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	// λֻ CMC GA ֱӸٶȣƶԤ
+	MoveComp->RequestDash();
+
+	UAbilityTask_WaitDelay* WaitTask = UAbilityTask_WaitDelay::WaitDelay(this, MoveComp->GetDashDuration());
+	WaitTask->OnFinish.AddDynamic(this, &UGA_Dash::OnDashFinished);
+	WaitTask->ReadyForActivation();
+}
+
+void UGA_Dash::OnDashFinished()
+{
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+}
@@ -7,11 +7,25 @@
 #include "GA_Dash.generated.h"
 
 /**
- * 
+ * ̣ GASCostGameplayEffectClassλƽ CMC ĳģʽ
+ *  SavedMove  FLAG_Custom_1 ͬͻԤ⡢ʱɻط
  */
 UCLASS()
 class ACTIONGAME_API UGA_Dash : public UAG_GameplayAbility
 {
 	GENERATED_BODY()
 
+public:
+	UGA_Dash();
+
+	virtual void ActivateAbility(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		const FGameplayEventData* TriggerEventData
+	) override;
+
+protected:
+	UFUNCTION()
+	void OnDashFinished();
 };
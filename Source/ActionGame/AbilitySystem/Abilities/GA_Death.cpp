@@ -2,9 +2,11 @@
 
 
 #include "AbilitySystem/Abilities/GA_Death.h"
+#include "ActionGameplayTags.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
 
 void UGA_Death::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
@@ -46,13 +48,10 @@ void UGA_Death::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const F
 			FGameplayEffectContextHandle RewardCtx = KillerASC->MakeEffectContext();
 			RewardCtx.AddSourceObject(ActorInfo->AvatarActor.Get());
 
-			FGameplayEffectSpecHandle RewardSpec = KillerASC->MakeOutgoingSpec(RewardEffect, 1.f, RewardCtx);
+			FGameplayEffectSpecHandle RewardSpec = UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(KillerASC, RewardEffect, 1.f, RewardCtx);
 			if (RewardSpec.IsValid())
 			{
-				static const FGameplayTag TAG_Data_Reward_Gold =
-					FGameplayTag::RequestGameplayTag(TEXT("Data.Reward.Gold"));
-
-				RewardSpec.Data->SetSetByCallerMagnitude(TAG_Data_Reward_Gold, Bounty);
+				RewardSpec.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Reward_Gold, Bounty);
 				KillerASC->ApplyGameplayEffectSpecToSelf(*RewardSpec.Data.Get());
 			}
 		}
@@ -3,12 +3,17 @@
 
 #include "AbilitySystem/Abilities/GA_Interact.h"
 
+#include "ActionGame.h"
+#include "ActionGameplayTags.h"
 #include "Interfaces/Interactable.h"
 
 #include "ActionGameCharacter.h"
+#include "ActionGameCollisionChannels.h"
 #include "ActorComponents/InteractCandidateComponent.h"
+#include "Subsystems/AG_InteractionSubsystem.h"
 
 #include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
+#include "AbilitySystemComponent.h"
 
 #include "Camera/CameraComponent.h"
 #include "GameFramework/Actor.h"
@@ -17,6 +22,9 @@
 #include "Engine/World.h"
 #include "Components/PrimitiveComponent.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interact Target Resolves"), STAT_AG_InteractResolves, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interact Target Cache Hits"), STAT_AG_InteractCacheHits, STATGROUP_ActionGame);
+
 UGA_Interact::UGA_Interact()
 {
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
@@ -46,8 +54,8 @@ void UGA_Interact::ActivateAbility(const FGameplayAbilitySpecHandle Handle, cons
 	// ȵ Super
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
-	// ѡУ齻Ŀ꣨Ȩж
-	AActor* TargetActor = FindBestInteractableTarget(ActorInfo);
+	// ѡУ齻Ŀ꣨Ȩж CheckCost ͬһν
+	AActor* TargetActor = GetInteractTarget(ActorInfo);
 	if (!TargetActor)
 	{
 		EndAbility(Handle, ActorInfo, ActivationInfo, false, true);
@@ -67,6 +75,12 @@ void UGA_Interact::ActivateAbility(const FGameplayAbilitySpecHandle Handle, cons
 	bool bCanInteract = false;
 	if (UInteractCandidateComponent* CandidateComp = Interactor->FindComponentByClass<UInteractCandidateComponent>())
 	{
+		// ѡϰ̶Ƶʸ£߽ΧĿƹʱܻûĿ꣬Уǰһ
+		if (UAG_InteractionSubsystem* Interaction = Interactor->GetWorld()->GetSubsystem<UAG_InteractionSubsystem>())
+		{
+			Interaction->UpdateCandidates(CandidateComp);
+		}
+
 		bCanInteract = IInteractable::Execute_CanInteract(TargetActor, Interactor) && CandidateComp->IsInteractCandidate(TargetActor);
 	}
 	if (!bCanInteract)
@@ -81,16 +95,25 @@ void UGA_Interact::ActivateAbility(const FGameplayAbilitySpecHandle Handle, cons
 		EndAbility(Handle, ActorInfo, ActivationInfo, false, true);
 		return;
 	}
+
 	IInteractable::Execute_ExecuteInteract(TargetActor, Interactor);	
 	EndAbility(Handle, ActorInfo, ActivationInfo, false, false);
 }
 
+void UGA_Interact::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
+{
+	// ͬһ֡ڵһνѡĿ꣨ؼԤ 0ֲ֡ˣ
+	TargetCache.Frame = 0;
+
+	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+}
+
 void UGA_Interact::ApplyCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const
 {
 	if (!ActorInfo || !ActorInfo->AvatarActor.IsValid())
 		return;
 
-	AActor* TargetActor = FindBestInteractableTarget(ActorInfo);
+	AActor* TargetActor = GetInteractTarget(ActorInfo);
 	if (!TargetActor)
 		return;
 
@@ -109,7 +132,7 @@ void UGA_Interact::ApplyCost(const FGameplayAbilitySpecHandle Handle, const FGam
 	{
 		// д SetByCallerע⸺ţ
 		SpecHandle.Data->SetSetByCallerMagnitude(
-			FGameplayTag::RequestGameplayTag("Data.Cost.Gold"),
+			AGGameplayTags::Data_Cost_Gold,
 			-Cost
 		);
 
@@ -129,7 +152,7 @@ bool UGA_Interact::CheckCost(const FGameplayAbilitySpecHandle Handle, const FGam
 		return false;
 
 	// Ŀ
-	AActor* TargetActor = FindBestInteractableTarget(ActorInfo);
+	AActor* TargetActor = GetInteractTarget(ActorInfo);
 	if (!TargetActor)
 		return false;
 
@@ -158,6 +181,35 @@ bool UGA_Interact::CheckCost(const FGameplayAbilitySpecHandle Handle, const FGam
 }
 
 
+AActor* UGA_Interact::GetInteractTarget(const FGameplayAbilityActorInfo* ActorInfo) const
+{
+	if (!ActorInfo || !ActorInfo->AvatarActor.IsValid())
+	{
+		return nullptr;
+	}
+
+	AActor* Avatar = ActorInfo->AvatarActor.Get();
+	const UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
+	const int16 PredictionKey = ASC ? ASC->ScopedPredictionKey.Current : 0;
+
+	const bool bSameFrame = TargetCache.Frame == GFrameCounter && TargetCache.Avatar.Get() == Avatar;
+	if (bSameFrame && TargetCache.PredictionKey == PredictionKey)
+	{
+		INC_DWORD_STAT(STAT_AG_InteractCacheHits);
+		return TargetCache.Target.Get();
+	}
+
+	INC_DWORD_STAT(STAT_AG_InteractResolves);
+
+	TargetCache.NumResolves = bSameFrame ? TargetCache.NumResolves + 1 : 1;
+	TargetCache.Avatar = Avatar;
+	TargetCache.Frame = GFrameCounter;
+	TargetCache.PredictionKey = PredictionKey;
+	TargetCache.Target = FindBestInteractableTarget(ActorInfo);
+
+	return TargetCache.Target.Get();
+}
+
 /*
 *  AddItem Destroy ״̬
 * ޸ ClientServerԵ
@@ -198,59 +250,34 @@ AActor* UGA_Interact::FindBestInteractableTarget(const FGameplayAbilityActorInfo
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(GA_Interact), false);
 	Params.AddIgnoredActor(Avatar);
 
-	FHitResult Hit;
+	APawn* Pawn = Cast<APawn>(Avatar);
 
-	// Trace Item
-	const bool bHitPickup = World->LineTraceSingleByChannel(
-		Hit,
-		TraceStart,
-		TraceEnd,
-		ECC_GameTraceChannel1,
-		Params
-	);
+	// ʰȡٿʹеһɽĿ꼴
+	// BlockAll / BlockAllDynamic 赲 Interact_Pickupǽʰȡǽ
+	const ECollisionChannel Channels[] =
+	{
+		FAGCollisionChannels::InteractPickup(),
+		FAGCollisionChannels::InteractUse(),
+	};
 
-	if (bHitPickup)
+	FHitResult Hit;
+	for (const ECollisionChannel Channel : Channels)
 	{
-		UPrimitiveComponent* HitComp = Hit.GetComponent();
-		if (HitComp && HitComp->ComponentHasTag(InteractTags::InteractTarget))
+		if (!World->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, Channel, Params))
 		{
-			AActor* TargetActor = HitComp->GetOwner();
-
-			if (TargetActor->Implements<UInteractable>())
-			{
-				APawn* Pawn = Cast<APawn>(Avatar);
-				if (IInteractable::Execute_CanInteract(TargetActor, Pawn))
-				{
-					return TargetActor;
-				}
-			}
+			continue;
 		}
-	}
-
-	// Trace Chest
-	const bool bHitUse = World->LineTraceSingleByChannel(
-		Hit,
-		TraceStart,
-		TraceEnd,
-		ECC_GameTraceChannel2,
-		Params
-	);
 
-	if (bHitUse)
-	{
 		UPrimitiveComponent* HitComp = Hit.GetComponent();
-		if (HitComp && HitComp->ComponentHasTag(InteractTags::InteractTarget))
+		if (!HitComp || !HitComp->ComponentHasTag(InteractTags::InteractTarget))
+		{
+			continue;
+		}
+
+		AActor* TargetActor = HitComp->GetOwner();
+		if (TargetActor && TargetActor->Implements<UInteractable>() && IInteractable::Execute_CanInteract(TargetActor, Pawn))
 		{
-			AActor* TargetActor = HitComp->GetOwner();
-
-			if (TargetActor->Implements<UInteractable>())
-			{
-				APawn* Pawn = Cast<APawn>(Avatar);
-				if (IInteractable::Execute_CanInteract(TargetActor, Pawn))
-				{
-					return TargetActor;
-				}
-			}
+			return TargetActor;
 		}
 	}
 
@@ -10,7 +10,23 @@
 class UInteractable;
 
 /**
- * 
+ * һνԵĿ껺
+ * CheckCost / ApplyCost / ActivateAbility ͬһ֡ͬһԤ¹һĿֻ꣬һѡ
+ */
+struct FInteractTargetCache
+{
+	TWeakObjectPtr<AActor> Avatar;
+	TWeakObjectPtr<AActor> Target;
+	uint64 Frame = 0;
+	int16 PredictionKey = 0;
+
+	/** μԵĽ ActionGame.Interact.SingleTargetResolve  */
+	int32 NumResolves = 0;
+};
+
+/**
+ * ִУ
+ * Ŀ갴ʰȡ / ʹͨѡÿμֻһ
  */
 UCLASS()
 class ACTIONGAME_API UGA_Interact : public UGameplayAbility
@@ -29,6 +45,14 @@ public:
 		const FGameplayEventData* TriggerEventData
 	) override;
 
+	virtual void EndAbility(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		bool bReplicateEndAbility,
+		bool bWasCancelled
+	) override;
+
 	virtual void ApplyCost(
 		const FGameplayAbilitySpecHandle Handle,
 		const FGameplayAbilityActorInfo* ActorInfo,
@@ -41,9 +65,15 @@ public:
 		OUT FGameplayTagContainer* OptionalRelevantTags
 	) const override;
 
+	// һμĿ걻ĴΪ 1
+	int32 GetNumTargetResolves() const { return TargetCache.NumResolves; }
+
 protected:
 	
-	// Ŀѡ
+	// Ŀѡ񣺶棬ͬһμֻһ
+	AActor* GetInteractTarget(const FGameplayAbilityActorInfo* ActorInfo) const;
+
+	// ʵʵѡ޸ã
 	AActor* FindBestInteractableTarget(const FGameplayAbilityActorInfo* ActorInfo) const;
 
 
@@ -61,4 +91,8 @@ protected:
 	// ߳
 	UPROPERTY(EditDefaultsOnly, Category = "Interaction")
 	float TraceDistance = 2000.0f;
+
+private:
+	// CheckCost / ApplyCost  const
+	mutable FInteractTargetCache TargetCache;
 };
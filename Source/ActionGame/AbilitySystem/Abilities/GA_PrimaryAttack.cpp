@@ -2,35 +2,41 @@
 
 #include "AbilitySystem/Abilities/GA_PrimaryAttack.h"
 
+#include "ActionGame.h"
+#include "ActionGameplayTags.h"
 #include "ActionGameCharacter.h"
+#include "ActionGameCollisionChannels.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemLog.h"
+#include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
+#include "Abilities/Tasks/AbilityTask_WaitGameplayEvent.h"
+#include "Engine/BlueprintGeneratedClass.h"
 #include "GameFramework/PlayerController.h"
 #include "DrawDebugHelpers.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
+#include "AbilitySystem/AG_GameplayEffectContext.h"
 #include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
 #include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
+#include "ActorComponents/AG_EnemyCombatComponent.h"
+#include "Subsystems/AG_DamageAccumulatorSubsystem.h"
+#include "Subsystems/AG_ImpactCueSubsystem.h"
 
-static ECollisionChannel GetChannelByName(FName Name)
-{
-	const UCollisionProfile* Profile = UCollisionProfile::Get();
-	if (!Profile) return ECC_Visibility;
-
-	for (int32 i = 0; i < ECC_MAX; i++)
-	{
-		if (Profile->ReturnChannelNameFromContainerIndex(i) == Name)
-		{
-			return (ECollisionChannel)i;
-		}
-	}
+DECLARE_CYCLE_STAT(TEXT("Primary Attack Shot"), STAT_AG_PrimaryAttackShot, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Primary Attack Activations (Native)"), STAT_AG_PrimaryAttackNative, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Primary Attack Activations (Blueprint)"), STAT_AG_PrimaryAttackBlueprint, STATGROUP_ActionGame);
 
-	UE_LOG(LogTemp, Warning, TEXT("Collision Channel not found: %s (fallback to Visibility)"), *Name.ToString());
-	return ECC_Visibility;
-}
+static TAutoConsoleVariable<int32> CVarPrimaryAttackNativeFlow(
+	TEXT("ag.PrimaryAttack.NativeFlow"),
+	1,
+	TEXT("1: primary attack runs its C++ activation flow unless a Blueprint subclass still implements K2_OnActivateFromEvent without a FireMontage; 0: always use the Blueprint K2_OnActivateFromEvent graph when implemented (for comparison)"),
+	ECVF_Default
+);
 
 UGA_PrimaryAttack::UGA_PrimaryAttack()
+	: bHasBlueprintActivateFromEvent(false)
+	, bHasBlueprintShotFired(false)
 {
 	// Ԥ⣺ͻӦ룬У鲢ͬ
 	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
@@ -41,12 +47,35 @@ UGA_PrimaryAttack::UGA_PrimaryAttack()
 	// ĬCueҲͼ︲Tag
 	if (!ImpactCueTag.IsValid())
 	{
-		ImpactCueTag = FGameplayTag::RequestGameplayTag(TEXT("GameplayCue.Weapon.Impact"));
+		ImpactCueTag = AGGameplayTags::GameplayCue_Weapon_Impact;
 	}
 
-	DamageDataTag = FGameplayTag::RequestGameplayTag(TEXT("Data.Damage"));
-	CooldownDataTag = FGameplayTag::RequestGameplayTag(TEXT("Data.CD.PrimaryAttack"));
-	CooldownTagContainer.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Cooldown.PrimaryAttack")));
+	DamageDataTag = AGGameplayTags::Data_Damage;
+	CooldownDataTag = AGGameplayTags::Data_CD_PrimaryAttack;
+	CooldownTagContainer.AddTag(AGGameplayTags::Cooldown_PrimaryAttack);
+	ShootEventTag = AGGameplayTags::Event_Combat_Shoot;
+
+	//  UGameplayAbility ж K2_ActivateAbility ķʽһ
+	auto ImplementedInBlueprint = [](const UFunction* Func) -> bool
+	{
+		return Func && ensure(Func->GetOuter()) && Func->GetOuter()->IsA(UBlueprintGeneratedClass::StaticClass());
+	};
+
+	bHasBlueprintActivateFromEvent = ImplementedInBlueprint(GetClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UGA_PrimaryAttack, K2_OnActivateFromEvent)));
+	bHasBlueprintShotFired = ImplementedInBlueprint(GetClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UGA_PrimaryAttack, K2_OnShotFired)));
+}
+
+void UGA_PrimaryAttack::PostLoad()
+{
+	Super::PostLoad();
+
+	// ͼ CDO ʱһΣѻûǨƵʲ
+	if (HasAnyFlags(RF_ClassDefaultObject) && UsesLegacyBlueprintFlow())
+	{
+		UE_LOG(LogActionGame, Warning,
+			TEXT("%s implements K2_OnActivateFromEvent without a FireMontage and still runs the legacy Blueprint fire graph. Set FireMontage/ShootEventTag and remove the graph to use the C++ flow."),
+			*GetNameSafe(GetClass()));
+	}
 }
 
 void UGA_PrimaryAttack::ActivateAbility(
@@ -67,10 +96,58 @@ void UGA_PrimaryAttack::ActivateAbility(
 		return;
 	}
 
-	// ͼ̣
-	// - PlayMontageAndWait
-	// - WaitGameplayEvent(Shoot)
-	K2_OnActivateFromEvent();
+	// ͼ̣ͼ PlayMontageAndWait + WaitGameplayEvent(Shoot) -> Shoot_TraceAndCue
+	// ͼʵͼû FireMontage ʱͼC++ ̻˲ͼ
+	if (UsesLegacyBlueprintFlow() || (bHasBlueprintActivateFromEvent && CVarPrimaryAttackNativeFlow.GetValueOnGameThread() == 0))
+	{
+		INC_DWORD_STAT(STAT_AG_PrimaryAttackBlueprint);
+		K2_OnActivateFromEvent();
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_AG_PrimaryAttackNative);
+
+	// 1) ύ + ȴApplyCooldown  CooldownReduction ʱͻԤ
+	if (!CommitAbilityChecked())
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	// 2) ûп𶯻֡𲢽
+	if (!FireMontage)
+	{
+		FireShot();
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
+		return;
+	}
+
+	// 3) ȵ¼ٲһ֡ʹ֪ͨʧ
+	ShootEventTask = UAbilityTask_WaitGameplayEvent::WaitGameplayEvent(this, ShootEventTag, nullptr, true);
+	ShootEventTask->EventReceived.AddDynamic(this, &UGA_PrimaryAttack::OnShootEvent);
+	ShootEventTask->ReadyForActivation();
+
+	MontageTask = UAbilityTask_PlayMontageAndWait::CreatePlayMontageAndWaitProxy(this, NAME_None, FireMontage, MontagePlayRate);
+	MontageTask->OnCompleted.AddDynamic(this, &UGA_PrimaryAttack::OnMontageFinished);
+	MontageTask->OnBlendOut.AddDynamic(this, &UGA_PrimaryAttack::OnMontageFinished);
+	MontageTask->OnInterrupted.AddDynamic(this, &UGA_PrimaryAttack::OnMontageCancelled);
+	MontageTask->OnCancelled.AddDynamic(this, &UGA_PrimaryAttack::OnMontageCancelled);
+	MontageTask->ReadyForActivation();
+}
+
+void UGA_PrimaryAttack::OnShootEvent(FGameplayEventData Payload)
+{
+	FireShot();
+}
+
+void UGA_PrimaryAttack::OnMontageFinished()
+{
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+}
+
+void UGA_PrimaryAttack::OnMontageCancelled()
+{
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 }
 
 void UGA_PrimaryAttack::EndAbility(
@@ -81,6 +158,10 @@ void UGA_PrimaryAttack::EndAbility(
 	bool bWasCancelled
 )
 {
+	//  Ability ԶֻϿ
+	MontageTask = nullptr;
+	ShootEventTask = nullptr;
+
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
@@ -126,18 +207,34 @@ void UGA_PrimaryAttack::Shoot_TraceAndCue()
 		return;
 	}
 
-	UAbilitySystemComponent* ASC = GetASC();
-	if (!ASC)
+	//  Shoot ֡ύӵ/ȴ
+	if (!CommitAbilityChecked())
 	{
-		UE_LOG(LogAbilitySystem, Warning, TEXT("[%s] Shoot_TraceAndCue FAILED: ASC is null"), *GetName());
+		// CommitʧͨʾԴ/ȴ/Tag
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
 
-	// ϣӵ/ȴҲ Shoot ֡ύ
-	if (!CommitAbilityChecked())
+	FireShot();
+}
+
+void UGA_PrimaryAttack::FireShot()
+{
+	AActionGameCharacter* Character = GetCharacter();
+	if (!Character) return;
+
+	// ֻ÷Ȩ Trace + GameplayCue 㲥
+	if (!Character->HasAuthority())
 	{
-		// CommitʧͨʾԴ/ȴ/Tag
-		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AG_PrimaryAttackShot);
+
+	UAbilitySystemComponent* ASC = GetASC();
+	if (!ASC)
+	{
+		UE_LOG(LogAbilitySystem, Warning, TEXT("[%s] FireShot FAILED: ASC is null"), *GetName());
 		return;
 	}
 
@@ -145,7 +242,7 @@ void UGA_PrimaryAttack::Shoot_TraceAndCue()
 	APlayerController* PC = Cast<APlayerController>(Character->GetController());
 	if (!PC)
 	{
-		UE_LOG(LogAbilitySystem, Warning, TEXT("[%s] Shoot_TraceAndCue FAILED: PlayerController is null"), *GetName());
+		UE_LOG(LogAbilitySystem, Warning, TEXT("[%s] FireShot FAILED: PlayerController is null"), *GetName());
 		return;
 	}
 
@@ -158,7 +255,7 @@ void UGA_PrimaryAttack::Shoot_TraceAndCue()
 	FCollisionQueryParams CamParams(SCENE_QUERY_STAT(PrimaryAttack_CamTrace), false);
 	CamParams.AddIgnoredActor(Character);
 
-	const ECollisionChannel WeaponChannel = GetChannelByName(TEXT("WeaponTrace"));
+	const ECollisionChannel WeaponChannel = FAGCollisionChannels::WeaponTrace();
 
 	FHitResult CamHit;
 	const bool bCamHit = Character->GetWorld()->LineTraceSingleByChannel(
@@ -175,7 +272,7 @@ void UGA_PrimaryAttack::Shoot_TraceAndCue()
 	USkeletalMeshComponent* Mesh = Character->GetMesh();
 	if (!Mesh)
 	{
-		UE_LOG(LogAbilitySystem, Warning, TEXT("[%s] Shoot_TraceAndCue FAILED: Mesh is null"), *GetName());
+		UE_LOG(LogAbilitySystem, Warning, TEXT("[%s] FireShot FAILED: Mesh is null"), *GetName());
 		return;
 	}
 
@@ -185,6 +282,7 @@ void UGA_PrimaryAttack::Shoot_TraceAndCue()
 
 	FCollisionQueryParams WeaponParams(SCENE_QUERY_STAT(PrimaryAttack_WeaponTrace), false);
 	WeaponParams.AddIgnoredActor(Character);
+	WeaponParams.bReturnPhysicalMaterial = true;	// Cue Ҫ
 
 	FHitResult Hit;
 	const bool bHit = Character->GetWorld()->LineTraceSingleByChannel(
@@ -197,20 +295,17 @@ void UGA_PrimaryAttack::Shoot_TraceAndCue()
 
 	if (bHit && Hit.bBlockingHit)
 	{
-		// 3)  ASC  CueؼҪ ExecuteGameplayCueOnActor
+		// 3) бֽͬһ֡ڵаӲü·
 		if (ImpactCueTag.IsValid())
 		{
-			FGameplayCueParameters Params;
-			Params.Location = Hit.ImpactPoint;
-			Params.Normal = Hit.ImpactNormal;
-			Params.Instigator = Character;
-			Params.EffectCauser = Character;
-
-			ASC->ExecuteGameplayCue(ImpactCueTag, Params);
+			if (UAG_ImpactCueSubsystem* CueSubsystem = Character->GetWorld()->GetSubsystem<UAG_ImpactCueSubsystem>())
+			{
+				CueSubsystem->QueueImpactCue(ImpactCueTag, Hit, Character);
+			}
 		}
 		else
 		{
-			UE_LOG(LogAbilitySystem, Warning, TEXT("[%s] Shoot_TraceAndCue: ImpactCueTag is invalid"), *GetName());
+			UE_LOG(LogAbilitySystem, Warning, TEXT("[%s] FireShot: ImpactCueTag is invalid"), *GetName());
 		}
 
 		if (DamageEffectClass)
@@ -221,7 +316,11 @@ void UGA_PrimaryAttack::Shoot_TraceAndCue()
 				UAbilitySystemComponent* TargetASC =
 					UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
 
-				if (TargetASC)
+				// û ASC 
+				UAG_EnemyCombatComponent* LiteTarget =
+					TargetASC ? nullptr : UAG_EnemyCombatComponent::FindForActor(TargetActor);
+
+				if (TargetASC || LiteTarget)
 				{
 					const float AttackPower =
 						ASC->GetNumericAttribute(UAG_AttributeSetBase::GetAttackPowerAttribute());
@@ -234,17 +333,28 @@ void UGA_PrimaryAttack::Shoot_TraceAndCue()
 					FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
 					Context.AddSourceObject(this);
 					Context.AddHitResult(Hit);
+					if (FAGGameplayEffectContext* AGContext = FAGGameplayEffectContext::Get(Context))
+					{
+						AGContext->SetDamageArchetype(EAGDamageArchetype::PrimaryWeapon);
+					}
 
-					FGameplayEffectSpecHandle SpecHandle =
-						ASC->MakeOutgoingSpec(DamageEffectClass, GetAbilityLevel(), Context);
-
-					if (SpecHandle.IsValid())
+					if (LiteTarget)
+					{
+						LiteTarget->ApplyGameplayDamage(-FinalDamage, Context);
+					}
+					else
 					{
-						SpecHandle.Data->SetSetByCallerMagnitude(DamageDataTag, -FinalDamage);
-						ASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+						// ͬһ֡ڶͬһĿ֡ĩϲ
+						UAG_DamageAccumulatorSubsystem::ApplyDamage(
+							Character, ASC, TargetASC, DamageEffectClass, GetAbilityLevel(), DamageDataTag, -FinalDamage, Context);
 					}
 				}
 			}
 		}
 	}
-}
+
+	if (bHasBlueprintShotFired)
+	{
+		K2_OnShotFired(Hit, bHit && Hit.bBlockingHit);
+	}
+}
\ No newline at end of file
@@ -4,8 +4,21 @@
 #include "AbilitySystem/Abilities/AG_GameplayAbility.h"
 #include "GA_PrimaryAttack.generated.h"
 
+class UAnimMontage;
+class UAbilityTask_PlayMontageAndWait;
+class UAbilityTask_WaitGameplayEvent;
 struct FGameplayEventData;
 
+/**
+ * 
+ * - C++ ̣ύ + ȴ-> ſ𶯻ȴ Shoot ¼ -> Trace / Cue / ˺ -> 
+ * - û FireMontage ʱֱ֡ӿ
+ * - ͼʵ K2_OnActivateFromEvent û FireMontage ʱ߾ɵͼ̣ͼͼʱ Warning
+ * - ag.PrimaryAttack.NativeFlow 0 ʱһ˻ͼ̣ڶԱ
+ *
+ * ǨƣBP_GA_PrimaryAttack Ŀǰ߾ͼ̡ҪͼĿ𶯻 FireMontage
+ * ȷ ShootEventTagȻɾ K2_OnActivateFromEvent ͼ֮Ż C++ 
+ */
 UCLASS()
 class ACTIONGAME_API UGA_PrimaryAttack : public UAG_GameplayAbility
 {
@@ -21,6 +34,8 @@ public:
 		const FGameplayEventData* TriggerEventData
 	) override;
 
+	virtual void PostLoad() override;
+
 	virtual void EndAbility(
 		const FGameplayAbilitySpecHandle Handle,
 		const FGameplayAbilityActorInfo* ActorInfo,
@@ -29,7 +44,7 @@ public:
 		bool bWasCancelled
 	) override;
 
-	/** ͼյ Shoot ¼ʱã Trace  GameplayCueͬ */
+	/** ͼյ Shoot ¼ʱãύ Trace + GameplayCue */
 	UFUNCTION(BlueprintCallable, Category = "PrimaryAttack")
 	void Shoot_TraceAndCue();
 
@@ -41,10 +56,41 @@ protected:
 		const FGameplayAbilityActorInfo* ActorInfo,
 		const FGameplayAbilityActivationInfo ActivationInfo) const override;
 
-	/** ͼʵ֣󲥷MontageȴShoot¼trace */
+	/** ͼ̣󲥷MontageȴShoot¼traceû FireMontage  ag.PrimaryAttack.NativeFlow 0 ʱʹã */
 	UFUNCTION(BlueprintImplementableEvent, Category = "PrimaryAttack")
 	void K2_OnActivateFromEvent();
 
+	/** ѡӣÿο */
+	UFUNCTION(BlueprintImplementableEvent, Category = "PrimaryAttack", meta = (DisplayName = "On Shot Fired"))
+	void K2_OnShotFired(const FHitResult& Hit, bool bBlockingHit);
+
+	// ===== C++  =====
+	/** Ȩ Trace + Cue + ˺ύ */
+	void FireShot();
+
+	/** ͼʵ K2_OnActivateFromEvent û FireMontageûǨƵľͼ */
+	bool UsesLegacyBlueprintFlow() const { return bHasBlueprintActivateFromEvent && !FireMontage; }
+
+	UFUNCTION()
+	void OnShootEvent(FGameplayEventData Payload);
+
+	UFUNCTION()
+	void OnMontageFinished();
+
+	UFUNCTION()
+	void OnMontageCancelled();
+
+	// =====  =====
+	/** 𶯻Ҫڿ֡ ShootEventTagΪʱ */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PrimaryAttack|Flow")
+	TObjectPtr<UAnimMontage> FireMontage = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PrimaryAttack|Flow")
+	float MontagePlayRate = 1.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PrimaryAttack|Flow")
+	FGameplayTag ShootEventTag;
+
 	// ===== Trace  =====
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PrimaryAttack|Trace")
 	float TraceDistance = 10000.f;
@@ -76,4 +122,15 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, Category = "PrimaryAttack|Cooldown")
 	FGameplayTagContainer CooldownTagContainer;
+
+private:
+	UPROPERTY()
+	TObjectPtr<UAbilityTask_PlayMontageAndWait> MontageTask;
+
+	UPROPERTY()
+	TObjectPtr<UAbilityTask_WaitGameplayEvent> ShootEventTask;
+
+	/** ʱ棺ͼǷʵ˶Ӧ¼ûʵ־Ͳ ProcessEvent */
+	uint8 bHasBlueprintActivateFromEvent : 1;
+	uint8 bHasBlueprintShotFired : 1;
 };
\ No newline at end of file
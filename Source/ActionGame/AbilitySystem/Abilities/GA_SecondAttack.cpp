@@ -3,4 +3,290 @@
 
 #include "AbilitySystem/Abilities/GA_SecondAttack.h"
 
+#include "ActionGame.h"
+#include "ActionGameplayTags.h"
+#include "ActionGameCharacter.h"
+#include "ActionGameCollisionChannels.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemLog.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "AbilitySystem/AG_GameplayEffectContext.h"
+#include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+#include "ActorComponents/AG_EnemyCombatComponent.h"
+#include "Characters/EnemyCharacterBase.h"
+#include "Subsystems/AG_AreaDamageSubsystem.h"
+#include "Subsystems/AG_ImpactCueSubsystem.h"
 
+DECLARE_CYCLE_STAT(TEXT("Second Attack Activate"), STAT_AG_SecondAttackActivate, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Second Attack Targets Hit"), STAT_AG_SecondAttackTargets, STATGROUP_ActionGame);
+
+UGA_SecondAttack::UGA_SecondAttack()
+{
+	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+
+	TargetClass = AEnemyCharacterBase::StaticClass();
+
+	ImpactCueTag = AGGameplayTags::GameplayCue_Weapon_Impact;
+	DamageDataTag = AGGameplayTags::Data_Damage;
+	IgnoreTargetTag = AGGameplayTags::State_Dead;
+}
+
+void UGA_SecondAttack::ActivateAbility(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo,
+	const FGameplayEventData* TriggerEventData
+)
+{
+	if (!ActorInfo || !ActorInfo->AvatarActor.IsValid())
+	{
+		UE_LOG(LogAbilitySystem, Warning,
+			TEXT("[%s] ActivateAbility FAILED: invalid ActorInfo/Avatar"),
+			*GetName());
+
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	if (!CommitAbilityChecked())
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	if (HasAuthority(&ActivationInfo))
+	{
+		FireChainShot();
+	}
+
+	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
+}
+
+void UGA_SecondAttack::SelectChainHops(
+	const FVector& From,
+	float Range,
+	int32 MaxHops,
+	TArray<FAGChainCandidate>& Pending,
+	TArray<FAGChainCandidate>& OutHops)
+{
+	const float RangeSq = Range * Range;
+	FVector HopFrom = From;
+
+	for (int32 Hop = 0; Hop < MaxHops && Pending.Num() > 0; ++Hop)
+	{
+		int32 BestIndex = INDEX_NONE;
+		float BestDistSq = RangeSq;
+
+		for (int32 i = 0; i < Pending.Num(); ++i)
+		{
+			const float DistSq = FVector::DistSquared(HopFrom, Pending[i].Location);
+			if (DistSq <= BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestIndex = i;
+			}
+		}
+
+		if (BestIndex == INDEX_NONE)
+		{
+			break;
+		}
+
+		const FAGChainCandidate& Chosen = OutHops.Add_GetRef(Pending[BestIndex]);
+		HopFrom = Chosen.Location;
+		Pending.RemoveAtSwap(BestIndex);
+	}
+}
+
+int32 UGA_SecondAttack::FireChainShot()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AG_SecondAttackActivate);
+
+	AActionGameCharacter* Character = GetCharacter();
+	UAbilitySystemComponent* ASC = GetASC();
+	UWorld* World = Character ? Character->GetWorld() : nullptr;
+	APlayerController* PC = Character ? Cast<APlayerController>(Character->GetController()) : nullptr;
+	if (!Character || !ASC || !World || !PC)
+	{
+		return 0;
+	}
+
+	// 1) 㣺ǹ
+	FVector CamLoc;
+	FRotator CamRot;
+	PC->GetPlayerViewPoint(CamLoc, CamRot);
+
+	USkeletalMeshComponent* Mesh = Character->GetMesh();
+	const FVector MuzzleLoc = Mesh ? Mesh->GetSocketLocation(MuzzleSocketName) : Character->GetActorLocation();
+	const FVector Dir = CamRot.Vector();
+	const FVector TraceEnd = MuzzleLoc + Dir * TraceDistance;
+
+	// 2) һߣObjectType ѯ·壬
+	FCollisionObjectQueryParams ObjParams;
+	ObjParams.AddObjectTypesToQuery(FAGCollisionChannels::Damageable());
+	ObjParams.AddObjectTypesToQuery(ECC_WorldStatic);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SecondAttack_Pierce), false, Character);
+	QueryParams.bReturnPhysicalMaterial = true;	// Cue Ҫ
+
+	TArray<FHitResult> Hits;
+	World->LineTraceMultiByObjectType(Hits, MuzzleLoc, TraceEnd, ObjParams, QueryParams);
+
+	TArray<UAbilitySystemComponent*> Targets;
+	TArray<UAG_EnemyCombatComponent*> LiteTargets;
+	TArray<FHitResult> ImpactHits;
+	TSet<AActor*> HitActors;
+
+	FVector ChainStart = TraceEnd;
+
+	for (const FHitResult& Hit : Hits)
+	{
+		// ̬ضϣǽĵ˴򲻵
+		if (Hit.Component.IsValid() && Hit.Component->GetCollisionObjectType() == ECC_WorldStatic)
+		{
+			ChainStart = Hit.ImpactPoint;
+			ImpactHits.Add(Hit);
+			break;
+		}
+
+		AActor* Actor = Hit.GetActor();
+		if (!IsValid(Actor) || (TargetClass && !Actor->IsA(TargetClass)))
+		{
+			continue;
+		}
+
+		bool bAlreadyHit = false;
+		HitActors.Add(Actor, &bAlreadyHit);
+		if (bAlreadyHit)
+		{
+			continue;
+		}
+
+		UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Actor);
+		if (TargetASC)
+		{
+			if (IgnoreTargetTag.IsValid() && TargetASC->HasMatchingGameplayTag(IgnoreTargetTag))
+			{
+				continue;
+			}
+			Targets.Add(TargetASC);
+		}
+		else
+		{
+			// 
+			UAG_EnemyCombatComponent* LiteTarget = UAG_EnemyCombatComponent::FindForActor(Actor);
+			if (!LiteTarget || (IgnoreTargetTag.IsValid() && LiteTarget->HasStateTag(IgnoreTargetTag)))
+			{
+				continue;
+			}
+			LiteTargets.Add(LiteTarget);
+		}
+
+		ImpactHits.Add(Hit);
+		ChainStart = Hit.ImpactPoint;
+
+		if (Targets.Num() + LiteTargets.Num() >= MaxPierceTargets)
+		{
+			break;
+		}
+	}
+
+	// 3) 䣺ֻд͸й˲ŵѡһηΧѯȫ
+	UAG_AreaDamageSubsystem* AreaDamage = World->GetSubsystem<UAG_AreaDamageSubsystem>();
+	if (AreaDamage && Targets.Num() + LiteTargets.Num() > 0 && MaxChainHops > 0 && ChainRange > 0.f)
+	{
+		TArray<UAbilitySystemComponent*> Candidates;
+		TArray<UAG_EnemyCombatComponent*> LiteCandidates;
+		AreaDamage->GatherTargets(ChainStart, ChainRange * MaxChainHops, Character, TargetClass, IgnoreTargetTag, Candidates, &LiteCandidates);
+
+		TArray<FAGChainCandidate> Pending;
+		Pending.Reserve(Candidates.Num() + LiteCandidates.Num());
+		for (UAbilitySystemComponent* Candidate : Candidates)
+		{
+			AActor* Avatar = Candidate->GetAvatarActor();
+			if (Avatar && !HitActors.Contains(Avatar))
+			{
+				Pending.Add({ Avatar, Candidate, nullptr, Avatar->GetActorLocation() });
+			}
+		}
+		for (UAG_EnemyCombatComponent* Candidate : LiteCandidates)
+		{
+			AActor* Owner = Candidate->GetOwner();
+			if (Owner && !HitActors.Contains(Owner))
+			{
+				Pending.Add({ Owner, nullptr, Candidate, Owner->GetActorLocation() });
+			}
+		}
+
+		TArray<FAGChainCandidate> Hops;
+		SelectChainHops(ChainStart, ChainRange, MaxChainHops, Pending, Hops);
+
+		FVector HopFrom = ChainStart;
+		for (const FAGChainCandidate& Chosen : Hops)
+		{
+			if (Chosen.ASC)
+			{
+				Targets.Add(Chosen.ASC);
+			}
+			else
+			{
+				LiteTargets.Add(Chosen.Lite);
+			}
+			ImpactHits.Emplace(Chosen.Actor, nullptr, Chosen.Location, (HopFrom - Chosen.Location).GetSafeNormal());
+
+			HopFrom = Chosen.Location;
+		}
+	}
+
+	// 4) һ Spec
+	int32 NumHit = 0;
+	if ((Targets.Num() > 0 || LiteTargets.Num() > 0) && DamageEffectClass)
+	{
+		const float AttackPower =
+			ASC->GetNumericAttribute(UAG_AttributeSetBase::GetAttackPowerAttribute());
+
+		const float DmgMul =
+			ASC->GetNumericAttribute(UAG_AttributeSetBase::GetDamageMultiplierAttribute());
+
+		const float FinalDamage = FMath::Max(0.f, AttackPower * DamageCoefficient * DmgMul);
+
+		FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
+		Context.AddSourceObject(this);
+		Context.AddOrigin(MuzzleLoc);
+		if (FAGGameplayEffectContext* AGContext = FAGGameplayEffectContext::Get(Context))
+		{
+			AGContext->SetDamageArchetype(EAGDamageArchetype::SecondaryWeapon);
+		}
+
+		FGameplayEffectSpecHandle SpecHandle =
+			UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(ASC, DamageEffectClass, GetAbilityLevel(), Context);
+
+		if (SpecHandle.IsValid())
+		{
+			SpecHandle.Data->SetSetByCallerMagnitude(DamageDataTag, -FinalDamage);
+			NumHit = UAG_AreaDamageSubsystem::ApplySpecToTargets(ASC, *SpecHandle.Data.Get(), Targets);
+			NumHit += UAG_AreaDamageSubsystem::ApplySpecToLiteTargets(*SpecHandle.Data.Get(), DamageDataTag, LiteTargets);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_AG_SecondAttackTargets, NumHit);
+
+	// 5) б
+	if (ImpactCueTag.IsValid())
+	{
+		if (UAG_ImpactCueSubsystem* CueSubsystem = World->GetSubsystem<UAG_ImpactCueSubsystem>())
+		{
+			for (const FHitResult& Hit : ImpactHits)
+			{
+				CueSubsystem->QueueImpactCue(ImpactCueTag, Hit, Character);
+			}
+		}
+	}
+
+	return NumHit;
+}
@@ -6,12 +6,89 @@
 #include "AbilitySystem/Abilities/AG_GameplayAbility.h"
 #include "GA_SecondAttack.generated.h"
 
+class AEnemyCharacterBase;
+class UAG_EnemyCombatComponent;
+struct FGameplayEventData;
+
+/** ѡλûһݣԾֻȽ */
+struct FAGChainCandidate
+{
+	AActor* Actor = nullptr;
+	UAbilitySystemComponent* ASC = nullptr;
+	UAG_EnemyCombatComponent* Lite = nullptr;
+	FVector Location = FVector::ZeroVector;
+};
+
 /**
- * 
+ * ͸ + 
+ * - һߣ̬ضϣ͸Ŀ
+ * - һηΧѯõѡԾڴаѡ Trace
+ * - Ŀ깲һ˺ Spec
  */
 UCLASS()
 class ACTIONGAME_API UGA_SecondAttack : public UAG_GameplayAbility
 {
 	GENERATED_BODY()
-	
+
+public:
+	UGA_SecondAttack();
+
+	virtual void ActivateAbility(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		const FGameplayEventData* TriggerEventData
+	) override;
+
+	/**  From ʼÿĺѡ˳д OutHops  Pending Ƴ */
+	static void SelectChainHops(
+		const FVector& From,
+		float Range,
+		int32 MaxHops,
+		TArray<FAGChainCandidate>& Pending,
+		TArray<FAGChainCandidate>& OutHops);
+
+protected:
+	/** Ȩ㣬Ŀ */
+	int32 FireChainShot();
+
+	// ===== Trace  =====
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SecondAttack|Trace")
+	float TraceDistance = 6000.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SecondAttack|Trace")
+	FName MuzzleSocketName = TEXT("Muzzle");
+
+	/** ഩ͸ĵ */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SecondAttack|Trace")
+	int32 MaxPierceTargets = 5;
+
+	// =====  =====
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SecondAttack|Chain")
+	int32 MaxChainHops = 4;
+
+	/**  */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SecondAttack|Chain")
+	float ChainRange = 800.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "SecondAttack|Target")
+	TSubclassOf<AEnemyCharacterBase> TargetClass;
+
+	UPROPERTY(EditDefaultsOnly, Category = "SecondAttack|Target")
+	FGameplayTag IgnoreTargetTag;
+
+	// SecondAttack|Tuning
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SecondAttack|Tuning")
+	float DamageCoefficient = 0.8f;
+
+	// Damage
+	UPROPERTY(EditDefaultsOnly, Category = "SecondAttack|Damage")
+	TSubclassOf<UGameplayEffect> DamageEffectClass = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category = "SecondAttack|Damage")
+	FGameplayTag DamageDataTag;
+
+	// ===== Cue  =====
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SecondAttack|Cue")
+	FGameplayTag ImpactCueTag;
 };
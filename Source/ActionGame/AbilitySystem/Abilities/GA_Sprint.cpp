@@ -6,6 +6,7 @@
 #include "GameFramework/Character.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "ActorComponents/AG_CharacterMovementComponent.h"
 #include <Abilities/Tasks/AbilityTask_WaitGameplayEvent.h>
 
 UGA_Sprint::UGA_Sprint()
@@ -53,7 +54,13 @@ void UGA_Sprint::ActivateAbility(
 		return;
 	}
 
-	// Apply Effect
+	// ٶ CMC ƶģﰴ FLAG_Custom_0 㣬ͻ/ͬһ Move һ
+	if (UAG_CharacterMovementComponent* MoveComp = Cast<UAG_CharacterMovementComponent>(Character->GetCharacterMovement()))
+	{
+		MoveComp->SetSprinting(true);
+	}
+
+	// Apply Effectֻ״̬ Tag/ģٸԣ
 	if (SprintStateEffect && ActorInfo->AbilitySystemComponent.IsValid())
 	{
 		FGameplayEffectContextHandle EffectContext = ActorInfo->AbilitySystemComponent->MakeEffectContext();
@@ -73,6 +80,17 @@ void UGA_Sprint::EndAbility(
 	bool bWasCancelled
 )
 {	
+	if (ActorInfo && ActorInfo->AvatarActor.IsValid())
+	{
+		if (ACharacter* Character = Cast<ACharacter>(ActorInfo->AvatarActor.Get()))
+		{
+			if (UAG_CharacterMovementComponent* MoveComp = Cast<UAG_CharacterMovementComponent>(Character->GetCharacterMovement()))
+			{
+				MoveComp->SetSprinting(false);
+			}
+		}
+	}
+
 	if (SprintEffectHandle.IsValid() && ActorInfo && ActorInfo->AbilitySystemComponent.IsValid())
 	{
 		ActorInfo->AbilitySystemComponent->RemoveActiveGameplayEffect(SprintEffectHandle);
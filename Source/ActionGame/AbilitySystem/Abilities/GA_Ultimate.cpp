@@ -3,3 +3,135 @@
 
 #include "AbilitySystem/Abilities/GA_Ultimate.h"
 
+#include "ActionGame.h"
+#include "ActionGameplayTags.h"
+#include "ActionGameCharacter.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemLog.h"
+#include "Engine/World.h"
+#include "AbilitySystem/AG_GameplayEffectContext.h"
+#include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+#include "Characters/EnemyCharacterBase.h"
+#include "ActorComponents/AG_EnemyCombatComponent.h"
+#include "Subsystems/AG_AreaDamageSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Ultimate Activate"), STAT_AG_UltimateActivate, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ultimate Targets Hit"), STAT_AG_UltimateTargets, STATGROUP_ActionGame);
+
+UGA_Ultimate::UGA_Ultimate()
+{
+	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+
+	TargetClass = AEnemyCharacterBase::StaticClass();
+
+	DamageDataTag = AGGameplayTags::Data_Damage;
+	IgnoreTargetTag = AGGameplayTags::State_Dead;
+}
+
+void UGA_Ultimate::ActivateAbility(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo,
+	const FGameplayEventData* TriggerEventData
+)
+{
+	if (!ActorInfo || !ActorInfo->AvatarActor.IsValid())
+	{
+		UE_LOG(LogAbilitySystem, Warning,
+			TEXT("[%s] ActivateAbility FAILED: invalid ActorInfo/Avatar"),
+			*GetName());
+
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	if (!CommitAbilityChecked())
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	// ˺ֻڷ㣬ͻԤֻύ/ȴ
+	if (HasAuthority(&ActivationInfo))
+	{
+		ApplyUltimateDamage();
+	}
+
+	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
+}
+
+int32 UGA_Ultimate::ApplyUltimateDamage()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AG_UltimateActivate);
+
+	AActionGameCharacter* Character = GetCharacter();
+	UAbilitySystemComponent* ASC = GetASC();
+	UWorld* World = Character ? Character->GetWorld() : nullptr;
+	if (!Character || !ASC || !World)
+	{
+		return 0;
+	}
+
+	const FVector Origin = Character->GetActorLocation();
+
+	// 1) һοռѯõĿ
+	UAG_AreaDamageSubsystem* AreaDamage = World->GetSubsystem<UAG_AreaDamageSubsystem>();
+	if (!AreaDamage)
+	{
+		return 0;
+	}
+
+	TArray<UAbilitySystemComponent*> Targets;
+	TArray<UAG_EnemyCombatComponent*> LiteTargets;
+	AreaDamage->GatherTargets(Origin, Radius, Character, TargetClass, IgnoreTargetTag, Targets, &LiteTargets);
+
+	// 2) Spec ֻһ
+	int32 NumHit = 0;
+	if ((Targets.Num() > 0 || LiteTargets.Num() > 0) && DamageEffectClass)
+	{
+		const float AttackPower =
+			ASC->GetNumericAttribute(UAG_AttributeSetBase::GetAttackPowerAttribute());
+
+		const float DmgMul =
+			ASC->GetNumericAttribute(UAG_AttributeSetBase::GetDamageMultiplierAttribute());
+
+		const float FinalDamage = FMath::Max(0.f, AttackPower * DamageCoefficient * DmgMul);
+
+		FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
+		Context.AddSourceObject(this);
+		Context.AddOrigin(Origin);
+		if (FAGGameplayEffectContext* AGContext = FAGGameplayEffectContext::Get(Context))
+		{
+			AGContext->SetDamageArchetype(EAGDamageArchetype::Ultimate);
+		}
+
+		FGameplayEffectSpecHandle SpecHandle =
+			UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(ASC, DamageEffectClass, GetAbilityLevel(), Context);
+
+		if (SpecHandle.IsValid())
+		{
+			SpecHandle.Data->SetSetByCallerMagnitude(DamageDataTag, -FinalDamage);
+
+			// 3) Ӧãĵ˽Уһ֡չ
+			NumHit = UAG_AreaDamageSubsystem::ApplySpecToTargets(ASC, *SpecHandle.Data.Get(), Targets);
+			NumHit += UAG_AreaDamageSubsystem::ApplySpecToLiteTargets(*SpecHandle.Data.Get(), DamageDataTag, LiteTargets);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_AG_UltimateTargets, NumHit);
+
+	// 4) ֻһ
+	if (CastCueTag.IsValid())
+	{
+		FGameplayCueParameters CueParams;
+		CueParams.Location = Origin;
+		CueParams.Instigator = Character;
+		CueParams.SourceObject = this;
+		CueParams.RawMagnitude = NumHit;
+		ASC->ExecuteGameplayCue(CastCueTag, CueParams);
+	}
+
+	return NumHit;
+}
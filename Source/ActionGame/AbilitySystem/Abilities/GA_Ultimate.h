@@ -6,13 +6,59 @@
 #include "AbilitySystem/Abilities/AG_GameplayAbility.h"
 #include "GA_Ultimate.generated.h"
 
+class AEnemyCharacterBase;
+struct FGameplayEventData;
+
 /**
- * 
+ * УԽɫΪĵΧ˺
+ * - һοռѯռĿ
+ * - ˺ Spec ֻһΣӦõĿ
+ * - ĵ˽з֡
  */
 UCLASS()
 class ACTIONGAME_API UGA_Ultimate : public UAG_GameplayAbility
 {
 	GENERATED_BODY()
-	
-	
+
+public:
+	UGA_Ultimate();
+
+	virtual void ActivateAbility(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		const FGameplayEventData* TriggerEventData
+	) override;
+
+protected:
+	/** Ȩ㣬Ŀ */
+	int32 ApplyUltimateDamage();
+
+	// Ultimate|Area
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ultimate|Area")
+	float Radius = 3000.f;
+
+	/** ֻ͵ Actor Ч */
+	UPROPERTY(EditDefaultsOnly, Category = "Ultimate|Area")
+	TSubclassOf<AEnemyCharacterBase> TargetClass;
+
+	/** Ŀ Tag ʱ */
+	UPROPERTY(EditDefaultsOnly, Category = "Ultimate|Area")
+	FGameplayTag IgnoreTargetTag;
+
+	// Ultimate|Tuning
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ultimate|Tuning")
+	float DamageCoefficient = 5.0f;
+
+	// Damage
+	UPROPERTY(EditDefaultsOnly, Category = "Ultimate|Damage")
+	TSubclassOf<UGameplayEffect> DamageEffectClass = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Ultimate|Damage")
+	FGameplayTag DamageDataTag;
+
+	// ===== Cue  =====
+	/** ֻһΣĿ */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ultimate|Cue")
+	FGameplayTag CastCueTag;
 };
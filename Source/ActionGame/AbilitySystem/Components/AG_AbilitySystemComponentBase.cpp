@@ -1,58 +1,69 @@
 // AG_AbilitySystemComponentBase.cpp
 
 #include "AG_AbilitySystemComponentBase.h"
+#include "ActionGameplayTags.h"
 #include "DataAssets/DA_Item.h"
 
+#include "ActionGame.h"
+
 #include "AbilitySystem/Abilities/AG_GameplayAbility.h"
 #include "GameplayEffect.h"
 #include "ActionGameCharacter.h"
 #include "ActorComponents/ItemContainerComponent.h"
 
-/*
- */
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spec Templates Built"), STAT_AG_SpecTemplatesBuilt, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spec Template Reuses"), STAT_AG_SpecTemplateReuses, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Specs Built (Uncached)"), STAT_AG_SpecsUncached, STATGROUP_ActionGame);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Item Effects Applied"), STAT_AG_ItemEffectsApplied, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Item Effects Updated In Place"), STAT_AG_ItemEffectsUpdated, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Set Grants"), STAT_AG_AbilityGrants, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Set Grants Skipped"), STAT_AG_AbilityGrantsSkipped, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Activatable Ability Specs"), STAT_AG_ActivatableAbilities, STATGROUP_ActionGame);
+
+/* ===============================
+ * Item  GAS
+ * =============================== */
 
 void UAG_AbilitySystemComponentBase::ApplyItem(const UDA_Item* Item, int32 OldCount, int32 NewCount)
 {
-	UE_LOG(LogTemp, Warning, (TEXT("APPLY ITEM")));
-
 	if (!Item)
 	{
 		return;
 	}
 
-	// ״λøƷʱ Effect / Ability
 	if (NewCount <= 0)
 	{
+		RemoveItem(Item);
 		return;
 	}
 
-	
-	const int32 Delta = NewCount - OldCount;
-	for (int32 i = 0; i < Delta; i++)
+	if (NewCount == OldCount)
 	{
-		/* ===============================
-		*  GameplayEffect
-		* =============================== */
-		for (TSubclassOf<UGameplayEffect> EffectClass : Item->GrantedEffects)
-		{
-			if (!EffectClass)
-			{
-				continue;
-			}
+		return;
+	}
 
-			// ֱӶӦ GameplayEffect
-			ApplyGameplayEffectToSelf(
-				EffectClass.GetDefaultObject(),
-				1.0f,
-				MakeEffectContext()
-			);
+	FItemGrantHandles& Grant = ItemGrants.FindOrAdd(Item);
+	Grant.EffectHandles.SetNum(Item->GrantedEffects.Num());
+
+	/* ===============================
+	 *  GameplayEffect
+	 * =============================== */
+	for (int32 i = 0; i < Item->GrantedEffects.Num(); ++i)
+	{
+		const TSubclassOf<UGameplayEffect> EffectClass = Item->GrantedEffects[i];
+		if (!EffectClass)
+		{
+			continue;
 		}
+
+		ApplyItemEffect(EffectClass, Grant.EffectHandles[i], OldCount, NewCount);
 	}
 
 	/* ===============================
-	 *  GameplayAbility
+	 *  GameplayAbilityֻ״λʱ
 	 * =============================== */
-	if (OldCount == 0)
+	if (Grant.AbilityHandles.Num() == 0)
 	{
 		for (TSubclassOf<UGameplayAbility> AbilityClass : Item->GrantedAbilities)
 		{
@@ -61,9 +72,151 @@ void UAG_AbilitySystemComponentBase::ApplyItem(const UDA_Item* Item, int32 OldCo
 				continue;
 			}
 
-			GiveAbility(FGameplayAbilitySpec(AbilityClass, 1));
+			Grant.AbilityHandles.Add(GiveAbility(FGameplayAbilitySpec(AbilityClass, 1)));
+		}
+	}
+}
+
+void UAG_AbilitySystemComponentBase::ApplyItemEffect(
+	TSubclassOf<UGameplayEffect> EffectClass,
+	TArray<FActiveGameplayEffectHandle>& Handles,
+	int32 OldCount,
+	int32 NewCount)
+{
+	const UGameplayEffect* EffectCDO = EffectClass.GetDefaultObject();
+	const bool bInstant = EffectCDO->DurationPolicy == EGameplayEffectDurationType::Instant;
+	const bool bStacking = EffectCDO->GetStackingType() != EGameplayEffectStackingType::None;
+	const bool bScalesWithStack = ScalesWithItemStack(EffectCDO);
+
+	// ߼Ƴʵٸ٣水Ӧ
+	Handles.RemoveAll([this](const FActiveGameplayEffectHandle& Handle)
+	{
+		return !GetActiveGameplayEffect(Handle);
+	});
+
+	// ˲ʱЧƷֻʱӦ
+	if (bInstant)
+	{
+		const int32 Delta = NewCount - OldCount;
+		if (Delta <= 0)
+		{
+			return;
+		}
+
+		FGameplayEffectSpecHandle Spec = MakeOutgoingSpec(EffectClass, 1.f, MakeEffectContext());
+		if (!Spec.IsValid())
+		{
+			return;
+		}
+
+		// ȡ Data.Item.Stack һӦÿƷӦһ
+		Spec.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Item_Stack, bScalesWithStack ? Delta : 1);
+		const int32 NumApplications = bScalesWithStack ? 1 : Delta;
+		for (int32 Index = 0; Index < NumApplications; ++Index)
+		{
+			ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+		}
+		INC_DWORD_STAT_BY(STAT_AG_ItemEffectsApplied, NumApplications);
+		return;
+	}
+
+	// ʵGE Դѵȡ Data.Item.Stack
+	if (bStacking || bScalesWithStack)
+	{
+		if (Handles.Num() == 0)
+		{
+			FGameplayEffectSpecHandle Spec = MakeOutgoingSpec(EffectClass, 1.f, MakeEffectContext());
+			if (!Spec.IsValid())
+			{
+				return;
+			}
+
+			if (bStacking)
+			{
+				Spec.Data->SetStackCount(NewCount);
+			}
+			Spec.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Item_Stack, NewCount);
+
+			const FActiveGameplayEffectHandle Handle = ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+			if (Handle.IsValid())
+			{
+				Handles.Add(Handle);
+			}
+			INC_DWORD_STAT(STAT_AG_ItemEffectsApplied);
+			return;
+		}
+
+		// мʵԭظ£ظ Apply
+		const FActiveGameplayEffectHandle Handle = Handles[0];
+		if (bStacking)
+		{
+			// GE Դѵ = Ʒ
+			if (NewCount > OldCount)
+			{
+				FGameplayEffectSpecHandle Spec = MakeOutgoingSpec(EffectClass, 1.f, MakeEffectContext());
+				if (Spec.IsValid())
+				{
+					Spec.Data->SetStackCount(NewCount - OldCount);
+					ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+				}
+			}
+			else
+			{
+				RemoveActiveGameplayEffect(Handle, OldCount - NewCount);
+			}
+		}
+
+		// 㲻дʵ SetByCallerͳһͬ
+		if (GetActiveGameplayEffect(Handle))
+		{
+			UpdateActiveGameplayEffectSetByCallerMagnitude(Handle, AGGameplayTags::Data_Item_Stack, NewCount);
+		}
+
+		INC_DWORD_STAT(STAT_AG_ItemEffectsUpdated);
+		return;
+	}
+
+	//  GEÿƷһʵΪһ
+	if (Handles.Num() < NewCount)
+	{
+		FGameplayEffectSpecHandle Spec = MakeOutgoingSpec(EffectClass, 1.f, MakeEffectContext());
+		if (!Spec.IsValid())
+		{
+			return;
+		}
+
+		Spec.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Item_Stack, 1);
+		while (Handles.Num() < NewCount)
+		{
+			const FActiveGameplayEffectHandle Handle = ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+			if (!Handle.IsValid())
+			{
+				// ߻Ӧʧܣ
+				break;
+			}
+			Handles.Add(Handle);
+			INC_DWORD_STAT(STAT_AG_ItemEffectsApplied);
+		}
+	}
+
+	while (Handles.Num() > NewCount)
+	{
+		RemoveActiveGameplayEffect(Handles.Pop());
+	}
+}
+
+bool UAG_AbilitySystemComponentBase::ScalesWithItemStack(const UGameplayEffect* EffectCDO)
+{
+	for (const FGameplayModifierInfo& Modifier : EffectCDO->Modifiers)
+	{
+		if (Modifier.ModifierMagnitude.GetMagnitudeCalculationType() == EGameplayEffectMagnitudeCalculation::SetByCaller
+			&& Modifier.ModifierMagnitude.GetSetByCallerFloat().DataTag == AGGameplayTags::Data_Item_Stack)
+		{
+			return true;
 		}
 	}
+
+	return false;
 }
 
 void UAG_AbilitySystemComponentBase::RemoveItem(const UDA_Item* Item)
@@ -72,4 +225,315 @@ void UAG_AbilitySystemComponentBase::RemoveItem(const UDA_Item* Item)
 	{
 		return;
 	}
+
+	FItemGrantHandles Grant;
+	if (!ItemGrants.RemoveAndCopyValue(Item, Grant))
+	{
+		return;
+	}
+
+	ClearItemGrant(Grant);
+}
+
+void UAG_AbilitySystemComponentBase::ClearItemGrant(const FItemGrantHandles& Grant)
+{
+	for (const TArray<FActiveGameplayEffectHandle>& Handles : Grant.EffectHandles)
+	{
+		for (const FActiveGameplayEffectHandle& Handle : Handles)
+		{
+			RemoveActiveGameplayEffect(Handle);
+		}
+	}
+
+	for (const FGameplayAbilitySpecHandle& Handle : Grant.AbilityHandles)
+	{
+		if (Handle.IsValid())
+		{
+			ClearAbility(Handle);
+		}
+	}
+}
+
+/* ===============================
+ * Ability Set ¼
+ * =============================== */
+
+void UAG_AbilitySystemComponentBase::GrantAbilitySet(
+	FName SetName,
+	const TArray<TSubclassOf<UGameplayAbility>>& Abilities,
+	const TArray<TSubclassOf<UGameplayEffect>>& Effects,
+	UObject* SourceObject)
+{
+	if (!IsOwnerActorAuthoritative())
+	{
+		return;
+	}
+
+	FAbilitySetGrant& Grant = AbilitySetGrants.FindOrAdd(SetName);
+
+	/* ---------- Ability ---------- */
+	TSet<const UClass*> DesiredAbilities;
+	for (const TSubclassOf<UGameplayAbility>& AbilityClass : Abilities)
+	{
+		if (!AbilityClass)
+		{
+			continue;
+		}
+
+		bool bDuplicate = false;
+		DesiredAbilities.Add(AbilityClass.Get(), &bDuplicate);
+		if (bDuplicate)
+		{
+			continue;
+		}
+
+		const FGameplayAbilitySpecHandle* Existing = Grant.Abilities.Find(AbilityClass.Get());
+		if (Existing && FindAbilitySpecFromHandle(*Existing))
+		{
+			INC_DWORD_STAT(STAT_AG_AbilityGrantsSkipped);
+			continue;
+		}
+
+		Grant.Abilities.Add(AbilityClass.Get(), GiveAbility(FGameplayAbilitySpec(AbilityClass, 1, INDEX_NONE, SourceObject)));
+		INC_DWORD_STAT(STAT_AG_AbilityGrants);
+	}
+
+	for (auto It = Grant.Abilities.CreateIterator(); It; ++It)
+	{
+		if (!DesiredAbilities.Contains(It.Key()))
+		{
+			ClearAbility(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	/* ---------- Effect ---------- */
+	TSet<const UClass*> DesiredEffects;
+	for (const TSubclassOf<UGameplayEffect>& EffectClass : Effects)
+	{
+		if (!EffectClass)
+		{
+			continue;
+		}
+
+		bool bDuplicate = false;
+		DesiredEffects.Add(EffectClass.Get(), &bDuplicate);
+		if (bDuplicate)
+		{
+			continue;
+		}
+
+		if (const FActiveGameplayEffectHandle* Existing = Grant.Effects.Find(EffectClass.Get()))
+		{
+			// ˲ʱ EffectЧЧĳ Effect ظӦ
+			if (!Existing->IsValid() || GetActiveGameplayEffect(*Existing))
+			{
+				INC_DWORD_STAT(STAT_AG_AbilityGrantsSkipped);
+				continue;
+			}
+		}
+
+		FGameplayEffectContextHandle Context = MakeEffectContext();
+		Context.AddSourceObject(SourceObject);
+
+		FActiveGameplayEffectHandle Handle;
+		FGameplayEffectSpecHandle Spec = MakeOutgoingSpec(EffectClass, 1.f, Context);
+		if (Spec.IsValid())
+		{
+			Handle = ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+		}
+
+		Grant.Effects.Add(EffectClass.Get(), Handle);
+		INC_DWORD_STAT(STAT_AG_AbilityGrants);
+	}
+
+	for (auto It = Grant.Effects.CreateIterator(); It; ++It)
+	{
+		if (!DesiredEffects.Contains(It.Key()))
+		{
+			if (It.Value().IsValid())
+			{
+				RemoveActiveGameplayEffect(It.Value());
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AG_ActivatableAbilities, GetActivatableAbilities().Num());
+}
+
+void UAG_AbilitySystemComponentBase::RevokeAbilitySet(FName SetName)
+{
+	FAbilitySetGrant Grant;
+	if (!AbilitySetGrants.RemoveAndCopyValue(SetName, Grant))
+	{
+		return;
+	}
+
+	for (const TPair<const UClass*, FGameplayAbilitySpecHandle>& Pair : Grant.Abilities)
+	{
+		ClearAbility(Pair.Value);
+	}
+
+	for (const TPair<const UClass*, FActiveGameplayEffectHandle>& Pair : Grant.Effects)
+	{
+		if (Pair.Value.IsValid())
+		{
+			RemoveActiveGameplayEffect(Pair.Value);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AG_ActivatableAbilities, GetActivatableAbilities().Num());
+}
+
+void UAG_AbilitySystemComponentBase::ResetLifeState()
+{
+	CancelAllAbilities();
+
+	TMap<TObjectKey<UDA_Item>, FItemGrantHandles> OldItemGrants = MoveTemp(ItemGrants);
+	ItemGrants.Reset();
+	for (const TPair<TObjectKey<UDA_Item>, FItemGrantHandles>& Pair : OldItemGrants)
+	{
+		ClearItemGrant(Pair.Value);
+	}
+
+	// ¼ĳ Effect ˲ʱ Effect ļ¼Գʼִ
+	TSet<FActiveGameplayEffectHandle> GrantedEffects;
+	for (TPair<FName, FAbilitySetGrant>& SetPair : AbilitySetGrants)
+	{
+		for (auto It = SetPair.Value.Effects.CreateIterator(); It; ++It)
+		{
+			if (It.Value().IsValid())
+			{
+				GrantedEffects.Add(It.Value());
+			}
+			else
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	for (const FActiveGameplayEffectHandle& Handle : GetActiveEffects(FGameplayEffectQuery()))
+	{
+		if (!GrantedEffects.Contains(Handle))
+		{
+			RemoveActiveGameplayEffect(Handle);
+		}
+	}
+
+	SetLooseGameplayTagCount(AGGameplayTags::State_Dead, 0);
+	SetLooseGameplayTagCount(AGGameplayTags::State_Ragdoll, 0);
+
+	SET_DWORD_STAT(STAT_AG_ActivatableAbilities, GetActivatableAbilities().Num());
+}
+
+/* ===============================
+ * Spec ģ建
+ * =============================== */
+
+FGameplayEffectSpecHandle UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(
+	UAbilitySystemComponent* ASC,
+	TSubclassOf<UGameplayEffect> EffectClass,
+	float Level,
+	const FGameplayEffectContextHandle& Context)
+{
+	if (!ASC || !EffectClass)
+	{
+		return FGameplayEffectSpecHandle();
+	}
+
+	UAG_AbilitySystemComponentBase* AGASC = Cast<UAG_AbilitySystemComponentBase>(ASC);
+	if (!AGASC)
+	{
+		INC_DWORD_STAT(STAT_AG_SpecsUncached);
+		return ASC->MakeOutgoingSpec(EffectClass, Level, Context);
+	}
+
+	const FGameplayEffectSpecHandle Template = AGASC->GetSpecTemplate(EffectClass, Level);
+	if (!Template.IsValid())
+	{
+		return Template;
+	}
+
+	// ģ壬ֻ ContextϢ/Դͬʱ²Դ Tag
+	FGameplayEffectSpecHandle Spec(new FGameplayEffectSpec(*Template.Data.Get()));
+	Spec.Data->SetContext(Context);
+
+	return Spec;
+}
+
+void UAG_AbilitySystemComponentBase::InvalidateSpecTemplates()
+{
+	SpecTemplates.Reset();
+}
+
+const FGameplayEffectSpec* UAG_AbilitySystemComponentBase::FindSpecTemplate(TSubclassOf<UGameplayEffect> EffectClass, float Level) const
+{
+	const FGameplayEffectSpecHandle* Template = SpecTemplates.Find(TPair<const UClass*, float>(EffectClass.Get(), Level));
+	return Template && Template->IsValid() ? Template->Data.Get() : nullptr;
+}
+
+FGameplayEffectSpecHandle UAG_AbilitySystemComponentBase::GetSpecTemplate(TSubclassOf<UGameplayEffect> EffectClass, float Level)
+{
+	FGameplayEffectSpecHandle& Template = SpecTemplates.FindOrAdd(TPair<const UClass*, float>(EffectClass.Get(), Level));
+
+	if (Template.IsValid())
+	{
+		INC_DWORD_STAT(STAT_AG_SpecTemplateReuses);
+		return Template;
+	}
+
+	Template = MakeOutgoingSpec(EffectClass, Level, MakeEffectContext());
+	WatchCapturedAttributes(EffectClass.GetDefaultObject());
+	INC_DWORD_STAT(STAT_AG_SpecTemplatesBuilt);
+
+	return Template;
+}
+
+void UAG_AbilitySystemComponentBase::WatchCapturedAttributes(const UGameplayEffect* EffectCDO)
+{
+	TArray<FGameplayEffectAttributeCaptureDefinition> CaptureDefs;
+	EffectCDO->GetAttributeCaptureDefinitions(CaptureDefs);
+
+	for (const FGameplayEffectAttributeCaptureDefinition& Def : CaptureDefs)
+	{
+		// Ŀ Apply ʱŲ񣬲Ӱģ
+		if (Def.AttributeSource != EGameplayEffectAttributeCaptureSource::Source || !Def.AttributeToCapture.IsValid())
+		{
+			continue;
+		}
+
+		bool bAlreadyWatched = false;
+		WatchedCaptureAttributes.Add(Def.AttributeToCapture, &bAlreadyWatched);
+		if (!bAlreadyWatched)
+		{
+			GetGameplayAttributeValueChangeDelegate(Def.AttributeToCapture).AddUObject(this, &UAG_AbilitySystemComponentBase::OnCapturedAttributeChanged);
+		}
+	}
+}
+
+void UAG_AbilitySystemComponentBase::OnCapturedAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	InvalidateSpecTemplates();
+}
+
+void UAG_AbilitySystemComponentBase::InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor)
+{
+	//  ASC  PlayerState ϣAvatar һ Pawn ھ ActorInfo һ
+	if (InAvatarActor && InAvatarActor != InOwnerActor)
+	{
+		const TObjectKey<AActor> NewPawnAvatar(InAvatarActor);
+		if (PawnAvatar != TObjectKey<AActor>() && PawnAvatar != NewPawnAvatar && InOwnerActor && InOwnerActor->HasAuthority())
+		{
+			ResetLifeState();
+		}
+		PawnAvatar = NewPawnAvatar;
+	}
+
+	Super::InitAbilityActorInfo(InOwnerActor, InAvatarActor);
+
+	// Avatar 仯ģԴϢʧЧ
+	// ЧϣԴ Tag ڿʱ SetContext ²ԴԵı仯 WatchCapturedAttributes 
+	InvalidateSpecTemplates();
 }
@@ -20,9 +20,9 @@ class UGameplayAbility;
  * -  Item ľ̬壬 GameplayEffect / GameplayAbility
  *
  * ԭ
- * -  Item ʱ״̬
  * -  Item Դ / UI / ԣ
- * - κ Item ѵļ
+ * - κ Item ѵļ㣬ֻ仯
+ * - ÿƷÿ Effect ֻһʵ¼ԱԭظºƳ
  *
  * Item ߼ UItemContainerComponent 
  */
@@ -41,24 +41,124 @@ public:
 	  * ĳƷ / 仯ʱ
 	  *
 	  * @param Item        Ʒľ̬壨DataAsset
+	  * @param OldCount    仯ǰĶѵ
 	  * @param NewCount    ƷǰĶѵ
 	  *
-	  * ˵
-	  * - Phase 1 У
-	  *   - ԼʵΪ״ʱ Effect / Ability
-	  *   - ݲƳˢ¡ٵȸ
-	  * - ѵֵЧӦ GameplayEffect 
+	  * Чӳ䣺
+	  * - GE Դѵ = ʱ㣬ʱƳӦʵϵ Data.Item.Stack ͬΪ
+	  * - GE  Modifier ȡ SetByCaller Data.Item.StackֻһʵԭظΪ
+	  *   ˲ʱ GE ÿֻӦһΣData.Item.Stack = 
+	  * -  GE־ΪÿƷӦһΣLevel 1Data.Item.Stack = 1
+	  * ÿѵ޹صƷ GE Ϊȡ Data.Item.Stack
 	  */
-	void ApplyItem(const UDA_Item* Item, int32 OldeCount, int32 NewCount);
+	void ApplyItem(const UDA_Item* Item, int32 OldCount, int32 NewCount);
+
+	/** ĳƷȫƳʱãƳƷ Effect / Ability */
+	void RemoveItem(const UDA_Item* Item);
+
+	/* ===============================
+	 * Ability Set ¼
+	 * =============================== */
 
 	/**
-	 * ĳƷȫƳʱ
+	 *  SetName һ Ability / EffectѼ¼
+	 * - ȻЧ
+	 * - бĳ
+	 * - ˲ʱ Effect һΣ֮ظӦ
+	 * ظ Possess / ýɫʱֻٵ GAS 
 	 *
-	 * @param Item ƳƷ
+	 * ҵ ASC  AActionGamePlayerState ϣֻ Avatar¼ ASC 
+	 * Ability ͳ Effect ԭã˲ʱ EffectԳʼڻ Avatar ʱ¼Ӧһ
+	 */
+	void GrantAbilitySet(
+		FName SetName,
+		const TArray<TSubclassOf<UGameplayAbility>>& Abilities,
+		const TArray<TSubclassOf<UGameplayEffect>>& Effects,
+		UObject* SourceObject = nullptr);
+
+	/**  SetName ȫ Ability / Effect */
+	void RevokeAbilitySet(FName SetName);
+
+	/* ===============================
+	 * Spec ģ建
+	 * =============================== */
+
+	/**
+	 * ȡ (EffectClass, Level) Ӧ Spec ģ壬һݲ Context 󷵻
 	 *
 	 * ˵
-	 * - Phase 1 ʱջֻСʵ
-	 * - Phase 2/3 ڴ˴ Ability / Effect Ƴ߼
+	 * - ʡ Spec ʼԴԲ񣬷ֵǶ÷д SetByCaller Ӱ
+	 * - ģ岶ԴԱ仯GE ޸ġSetNumericAttributeBase ȣʱģ
+	 * - Чȴ GE ȣϣԴ Tag ڿʱ²
+	 * - ASC Ǳʱ˻Ϊ MakeOutgoingSpec
 	 */
-	void RemoveItem(const UDA_Item* Item);
+	static FGameplayEffectSpecHandle MakeCachedOutgoingSpec(
+		UAbilitySystemComponent* ASC,
+		TSubclassOf<UGameplayEffect> EffectClass,
+		float Level,
+		const FGameplayEffectContextHandle& Context);
+
+	/** ϣAvatar 仯ԴԱ仯 */
+	void InvalidateSpecTemplates();
+
+	/** ǰģ壬ûʱΪգȷģ屻 */
+	const FGameplayEffectSpec* FindSpecTemplate(TSubclassOf<UGameplayEffect> EffectClass, float Level) const;
+
+protected:
+	virtual void InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor) override;
+
+private:
+	/** һƷоEffectHandles ± UDA_Item::GrantedEffects Ӧ */
+	struct FItemGrantHandles
+	{
+		/** ȡ Data.Item.Stack Դѵ GE ֻһÿƷһ */
+		TArray<TArray<FActiveGameplayEffectHandle>> EffectHandles;
+		TArray<FGameplayAbilitySpecHandle> AbilityHandles;
+	};
+
+	void ApplyItemEffect(
+		TSubclassOf<UGameplayEffect> EffectClass,
+		TArray<FActiveGameplayEffectHandle>& Handles,
+		int32 OldCount,
+		int32 NewCount);
+
+	/** GE  Modifier Ƿȡ SetByCaller Data.Item.StackŵƷ GE Դ */
+	static bool ScalesWithItemStack(const UGameplayEffect* EffectCDO);
+
+	void ClearItemGrant(const FItemGrantHandles& Grant);
+
+	TMap<TObjectKey<UDA_Item>, FItemGrantHandles> ItemGrants;
+
+	/** һ Ability Set ݣ¼ */
+	struct FAbilitySetGrant
+	{
+		TMap<const UClass*, FGameplayAbilitySpecHandle> Abilities;
+
+		/** ˲ʱ Effect ľЧֻ¼Ӧá */
+		TMap<const UClass*, FActiveGameplayEffectHandle> Effects;
+	};
+
+	TMap<FName, FAbilitySetGrant> AbilitySetGrants;
+
+	/**
+	 * Avatar һ Pawnʱһ״̬¼ݱ
+	 * - ȡ AbilityƷ裨ž Pawn ߣ
+	 * - Ƴ¼ Effect˺ȴBuff /  Loose Tag
+	 * - ˲ʱ Effect ġӦá¼һʱ³ʼ
+	 */
+	void ResetLifeState();
+
+	/** Owner  Avatar ͬʱңһε Avatarʶ */
+	TObjectKey<AActor> PawnAvatar;
+
+	FGameplayEffectSpecHandle GetSpecTemplate(TSubclassOf<UGameplayEffect> EffectClass, float Level);
+
+	/** ģԴԱ仯ʱϣÿֻһ */
+	void WatchCapturedAttributes(const UGameplayEffect* EffectCDO);
+
+	void OnCapturedAttributeChanged(const FOnAttributeChangeData& Data);
+
+	TMap<TPair<const UClass*, float>, FGameplayEffectSpecHandle> SpecTemplates;
+
+	TSet<FGameplayAttribute> WatchedCaptureAttributes;
 };
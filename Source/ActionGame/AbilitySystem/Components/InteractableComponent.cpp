@@ -2,108 +2,65 @@
 
 
 #include "AbilitySystem/Components/InteractableComponent.h"
-#include "Components/SphereComponent.h"
-#include "ActorComponents/InteractCandidateComponent.h"
 
-#include "ActionGameCharacter.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "Subsystems/AG_InteractionSubsystem.h"
 
-#include "GameFramework/Pawn.h"
-#include "GameFramework/Actor.h"
 
-
-// Sets default values for this component's properties
 UInteractableComponent::UInteractableComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
-	// Sphere ж
-	InteractSphere = CreateDefaultSubobject<USphereComponent>(TEXT("Sphere"));
-	InteractSphere->InitSphereRadius(250.f);
-	// Collision
-	InteractSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	InteractSphere->SetGenerateOverlapEvents(true);
-	InteractSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
-	InteractSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	// ѡɽ񰴹̶Ƶʼ㣬Ҫ Tick
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 
-// Called when the game starts
 void UInteractableComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	AActor* Owner = GetOwner();
-	if (!Owner)
+	if (UAG_InteractionSubsystem* Interaction = GetWorld()->GetSubsystem<UAG_InteractionSubsystem>())
 	{
-		return;
+		Interaction->RegisterInteractable(this);
 	}
 
-	//  Sphere ҵ Owner  Root 
-	if (USceneComponent* Root = Owner->GetRootComponent())
+	// ɽᱻͼAttach ȸַʽƶͳһӸı任ص·ָ
+	if (USceneComponent* Root = GetOwner() ? GetOwner()->GetRootComponent() : nullptr)
 	{
-		InteractSphere->AttachToComponent(
-			Root,
-			FAttachmentTransformRules::KeepRelativeTransform);
-	}
-
-	//  Overlap
-	InteractSphere->OnComponentBeginOverlap.AddDynamic(
-		this, &UInteractableComponent::OnSphereBeginOverlap);
-
-	InteractSphere->OnComponentEndOverlap.AddDynamic(
-		this, &UInteractableComponent::OnSphereEndOverlap);
-
-	TArray<AActor*> OverlappingActors;
-	InteractSphere->GetOverlappingActors(OverlappingActors, APawn::StaticClass());
-
-	for (AActor* Actor : OverlappingActors)
-	{
-		if (UInteractCandidateComponent* CandidateComp =
-			Actor->FindComponentByClass<UInteractCandidateComponent>())
-		{
-			CandidateComp->AddCandidate(GetOwner());
-		}
+		TrackedRoot = Root;
+		TransformUpdatedHandle = Root->TransformUpdated.AddUObject(this, &UInteractableComponent::OnOwnerTransformUpdated);
 	}
 }
 
-void UInteractableComponent::OnSphereBeginOverlap(
-	UPrimitiveComponent* OverlappedComp,
-	AActor* OtherActor,
-	UPrimitiveComponent* OtherComp,
-	int32 OtherBodyIndex,
-	bool bFromSweep,
-	const FHitResult& SweepResult)
+void UInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (!OtherActor)
+	if (USceneComponent* Root = TrackedRoot.Get())
 	{
-		return;
+		Root->TransformUpdated.Remove(TransformUpdatedHandle);
 	}
+	TrackedRoot.Reset();
+	TransformUpdatedHandle.Reset();
 
-	if (UInteractCandidateComponent* CandidateComp =
-		OtherActor->FindComponentByClass<UInteractCandidateComponent>())
+	if (UWorld* World = GetWorld())
 	{
-		CandidateComp->AddCandidate(GetOwner());
+		if (UAG_InteractionSubsystem* Interaction = World->GetSubsystem<UAG_InteractionSubsystem>())
+		{
+			Interaction->UnregisterInteractable(this);
+		}
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
-void UInteractableComponent::OnSphereEndOverlap(
-	UPrimitiveComponent* OverlappedComp,
-	AActor* OtherActor,
-	UPrimitiveComponent* OtherComp,
-	int32 OtherBodyIndex)
+void UInteractableComponent::OnOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
 {
-	if (!OtherActor)
+	if (!bRegisteredInGrid)
 	{
 		return;
 	}
 
-	if (UInteractCandidateComponent* CandidateComp =
-		OtherActor->FindComponentByClass<UInteractCandidateComponent>())
+	if (UAG_InteractionSubsystem* Interaction = GetWorld()->GetSubsystem<UAG_InteractionSubsystem>())
 	{
-		CandidateComp->RemoveCandidate(GetOwner());
+		Interaction->UpdateInteractable(this);
 	}
 }
-
-
@@ -6,39 +6,42 @@
 #include "Components/ActorComponent.h"
 #include "InteractableComponent.generated.h"
 
-class USphereComponent;
-
+class USceneComponent;
+enum class ETeleportType : uint8;
+
+/**
+ * ɽ
+ *  Tickײ壺BeginPlay עᵽ UAG_InteractionSubsystem ɷͳһҵĺѡ
+ *  Owner  TransformUpdatedƶԶ·ָ
+ */
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class ACTIONGAME_API UInteractableComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend class UAG_InteractionSubsystem;
+
 public:	
-	// Sets default values for this component's properties
 	UInteractableComponent();
 
+	float GetInteractRadius() const { return InteractRadius; }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-protected:
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Interact")
-	TObjectPtr<USphereComponent> InteractSphere;
+	void OnOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
 
 protected:
-	UFUNCTION()
-	void OnSphereBeginOverlap(
-		UPrimitiveComponent* OverlappedComp,
-		AActor* OtherActor,
-		UPrimitiveComponent* OtherComp,
-		int32 OtherBodyIndex,
-		bool bFromSweep,
-		const FHitResult& SweepResult);
-
-	UFUNCTION()
-	void OnSphereEndOverlap(
-		UPrimitiveComponent* OverlappedComp,
-		AActor* OtherActor,
-		UPrimitiveComponent* OtherComp,
-		int32 OtherBodyIndex);
+	/** ҽ˰뾶Ϊѡ */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Interact", meta = (ClampMin = "0"))
+	float InteractRadius = 250.f;
+
+private:
+	/** ɽά */
+	FIntPoint GridCell = FIntPoint::ZeroValue;
+	bool bRegisteredInGrid = false;
 
+	TWeakObjectPtr<USceneComponent> TrackedRoot;
+	FDelegateHandle TransformUpdatedHandle;
 };
@@ -1,8 +1,23 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ActionGame.h"
+#include "ActionGameCollisionChannels.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, ActionGame, "ActionGame" );
+class FActionGameModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		FAGCollisionChannels::Initialize();
+	}
 
-DEFINE_LOG_CATEGORY(LogActionGame)
\ No newline at end of file
+	virtual void ShutdownModule() override
+	{
+		FAGCollisionChannels::Shutdown();
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FActionGameModule, ActionGame, "ActionGame" );
+
+DEFINE_LOG_CATEGORY(LogActionGame)
@@ -3,6 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
 
 /** Main log category used across the project */
-DECLARE_LOG_CATEGORY_EXTERN(LogActionGame, Log, All);
\ No newline at end of file
+DECLARE_LOG_CATEGORY_EXTERN(LogActionGame, Log, All);
+
+/** Stat group for gameplay-side counters (stat ActionGame) */
+DECLARE_STATS_GROUP(TEXT("ActionGame"), STATGROUP_ActionGame, STATCAT_Advanced);
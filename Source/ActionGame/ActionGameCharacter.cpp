@@ -3,7 +3,9 @@
 #include "ActionGameCharacter.h"
 
 #include "ActionGame.h"
+#include "ActionGameplayTags.h"
 #include "ActionGamePlayerController.h"
+#include "ActionGamePlayerState.h"
 
 #include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
 #include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
@@ -87,14 +89,7 @@ AActionGameCharacter::AActionGameCharacter(const FObjectInitializer& ObjectIniti
 	// Note: The skeletal mesh and anim blueprint references on the Mesh component (inherited from Character)
 	// are set in the derived blueprint asset named ThirdPersonCharacter (to avoid direct content references in C++)
 
-	// Ability System
-	AbilitySystemComponent = CreateDefaultSubobject<UAG_AbilitySystemComponentBase>(TEXT("AbilitySystemComponent"));
-	AbilitySystemComponent->SetIsReplicated(true);
-	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetHealthAttribute()).AddUObject(this, &AActionGameCharacter::OnHealthAttributeChanged);
-	AbilitySystemComponent->RegisterGameplayTagEvent(FGameplayTag::RequestGameplayTag(TEXT("State.Ragdoll"), EGameplayTagEventType::NewOrRemoved)).AddUObject(this, &AActionGameCharacter::OnRagdollStateTagChanged);
-
-	AttributeSet = CreateDefaultSubobject<UAG_AttributeSetBase>(TEXT("AttributeSet"));
+	// Ability System  AActionGamePlayerState ϣPossess ʱ InitAbilitySystem ȡ
 
 	FootstepsComponent = CreateDefaultSubobject<UFootstepsComponent>(TEXT("FootstepsComponent"));
 
@@ -126,14 +121,6 @@ void AActionGameCharacter::BeginPlay()
 			HandleInteractCandidateChanged(Actor, true);
 		}
 	}
-
-	if (UAbilitySystemComponent* ASC = GetAbilitySystemComponent())
-	{
-		ASC->RegisterGameplayTagEvent(
-			FGameplayTag::RequestGameplayTag("State.Firing"),
-			EGameplayTagEventType::NewOrRemoved)
-			.AddUObject(this, &ThisClass::OnFiringTagChanged);
-	}
 }
 
 void AActionGameCharacter::PostInitializeComponents()
@@ -229,19 +216,78 @@ void AActionGameCharacter::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 
-	AbilitySystemComponent->InitAbilityActorInfo(this, this);
+	// 谴¼¼ PlayerState  ASC ϣ Pawn Ҳֻ
+	InitAbilitySystem();
 	GiveAbilities();
 	ApplyStartupEffects();
 	GrantSkillAbilities();
-	BindASCAttributeDelegates();
 }
 
 void AActionGameCharacter::OnRep_PlayerState()
 {
 	Super::OnRep_PlayerState();
 
-	// ASC˭ӵõ˭
-	AbilitySystemComponent->InitAbilityActorInfo(this, this);
+	InitAbilitySystem();
+
+	// OnRep_Pawn  PlayerState HUD  ASC Ҫȵ
+	if (AActionGamePlayerController* PC = Cast<AActionGamePlayerController>(GetController()))
+	{
+		PC->InitHUDWithPawn(this);
+	}
+}
+
+void AActionGameCharacter::UnPossessed()
+{
+	UninitAbilitySystem();
+
+	Super::UnPossessed();
+}
+
+void AActionGameCharacter::InitAbilitySystem()
+{
+	AActionGamePlayerState* PS = GetPlayerState<AActionGamePlayerState>();
+	if (!PS)
+	{
+		if (GetPlayerState())
+		{
+			UE_LOG(LogActionGame, Warning, TEXT("[%s] PlayerState %s is not an AActionGamePlayerState, character has no ASC"),
+				*GetName(), *GetPlayerState()->GetName());
+		}
+		UninitAbilitySystem();
+		return;
+	}
+
+	UnbindASCAttributeDelegates();
+
+	AbilitySystemComponent = PS->GetAGAbilitySystemComponent();
+	AttributeSet = PS->GetAttributeSet();
+
+	// Owner  PlayerStateAvatar Ǳ Pawn Pawn ʱ ASC һ״̬
+	AbilitySystemComponent->InitAbilityActorInfo(PS, this);
+	BindASCAttributeDelegates();
+
+	if (UAG_CharacterMovementComponent* Movement = Cast<UAG_CharacterMovementComponent>(GetCharacterMovement()))
+	{
+		Movement->CachedAbilitySystem();
+	}
+}
+
+void AActionGameCharacter::UninitAbilitySystem()
+{
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	UnbindASCAttributeDelegates();
+
+	AbilitySystemComponent = nullptr;
+	AttributeSet = nullptr;
+
+	if (UAG_CharacterMovementComponent* Movement = Cast<UAG_CharacterMovementComponent>(GetCharacterMovement()))
+	{
+		Movement->CachedAbilitySystem();
+	}
 }
 
 // =========================================================================
@@ -358,27 +404,34 @@ void AActionGameCharacter::GrantSkillAbilities()
 {
 	if (!HasAuthority()) return;
 	if (!AbilitySystemComponent) return;
-	if (!CharacterData.CharacterSkillDataAsset) return;
+
+	static const FName SkillSetName(TEXT("Skills"));
+
+	if (!CharacterData.CharacterSkillDataAsset)
+	{
+		AbilitySystemComponent->RevokeAbilitySet(SkillSetName);
+		return;
+	}
 
 	const auto& AbilitySet = CharacterData.CharacterSkillDataAsset->AbilitySetData.Abilities;
 
 	// ·1ɫֻ赱ǰװ4ܣ̶4λ
 	constexpr int32 MaxSkillSlots = 4;
 
-	for (int32 i = 0; i < AbilitySet.Num(); i++)
+	if (AbilitySet.Num() > MaxSkillSlots)
 	{
-		if (!AbilitySet[i]) continue;
-
-		if (i >= MaxSkillSlots)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[%s] Too many skills assigned, ignoring index %d (max %d)"),
-				*GetName(), i, MaxSkillSlots);
-			break;
-		}
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Too many skills assigned, ignoring index %d+ (max %d)"),
+			*GetName(), MaxSkillSlots, MaxSkillSlots);
+	}
 
-		FGameplayAbilitySpec Spec(AbilitySet[i], 1);
-		AbilitySystemComponent->GiveAbility(Spec);
+	TArray<TSubclassOf<UGameplayAbility>> SlotAbilities;
+	for (int32 i = 0; i < FMath::Min(AbilitySet.Num(), MaxSkillSlots); i++)
+	{
+		SlotAbilities.Add(AbilitySet[i]);
 	}
+
+	// ¼ظ Possess ظ
+	AbilitySystemComponent->GrantAbilitySet(SkillSetName, SlotAbilities, {}, CharacterData.CharacterSkillDataAsset);
 }
 
 FVector AActionGameCharacter::GetMuzzleLocation() const
@@ -394,7 +447,7 @@ bool AActionGameCharacter::ApplyGameplayEffectToSelf(
 	TSubclassOf<UGameplayEffect> Effect,
 	FGameplayEffectContextHandle InEffectContext)
 {
-	if (!Effect) return false;
+	if (!Effect || !AbilitySystemComponent) return false;
 
 	FGameplayEffectSpecHandle SpecHandle = AbilitySystemComponent->MakeOutgoingSpec(Effect, 1, InEffectContext);
 	if (SpecHandle.IsValid())
@@ -444,24 +497,17 @@ void AActionGameCharacter::GiveAbilities()
 {
 	if (HasAuthority() && AbilitySystemComponent)
 	{
-		for (auto DefaultAbiltiy : CharacterData.Abilities)
-		{
-			AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(DefaultAbiltiy));
-		}
+		static const FName DefaultAbilitySetName(TEXT("DefaultAbilities"));
+		AbilitySystemComponent->GrantAbilitySet(DefaultAbilitySetName, CharacterData.Abilities, {}, this);
 	}
 }
 
 void AActionGameCharacter::ApplyStartupEffects()
 {
-	if (GetLocalRole() == ROLE_Authority)
+	if (GetLocalRole() == ROLE_Authority && AbilitySystemComponent)
 	{
-		FGameplayEffectContextHandle EffectContext = AbilitySystemComponent->MakeEffectContext();
-		EffectContext.AddSourceObject(this);
-
-		for (auto CharacterEffect : CharacterData.Effects)
-		{
-			ApplyGameplayEffectToSelf(CharacterEffect, EffectContext);
-		}
+		static const FName StartupEffectSetName(TEXT("StartupEffects"));
+		AbilitySystemComponent->GrantAbilitySet(StartupEffectSetName, {}, CharacterData.Effects, this);
 	}
 }
 
@@ -547,6 +593,21 @@ void AActionGameCharacter::BindASCAttributeDelegates()
 		AbilitySystemComponent
 		->GetGameplayAttributeValueChangeDelegate(UAG_AttributeSetBase::GetMaxJumpCountAttribute())
 		.AddUObject(this, &AActionGameCharacter::OnMaxJumpCountChanged);
+
+	HealthChangedHandle =
+		AbilitySystemComponent
+		->GetGameplayAttributeValueChangeDelegate(UAG_AttributeSetBase::GetHealthAttribute())
+		.AddUObject(this, &AActionGameCharacter::OnHealthAttributeChanged);
+
+	RagdollTagChangedHandle =
+		AbilitySystemComponent
+		->RegisterGameplayTagEvent(AGGameplayTags::State_Ragdoll, EGameplayTagEventType::NewOrRemoved)
+		.AddUObject(this, &AActionGameCharacter::OnRagdollStateTagChanged);
+
+	FiringTagChangedHandle =
+		AbilitySystemComponent
+		->RegisterGameplayTagEvent(AGGameplayTags::State_Firing, EGameplayTagEventType::NewOrRemoved)
+		.AddUObject(this, &AActionGameCharacter::OnFiringTagChanged);
 }
 
 void AActionGameCharacter::UnbindASCAttributeDelegates()
@@ -564,6 +625,27 @@ void AActionGameCharacter::UnbindASCAttributeDelegates()
 
 		MaxJumpCountChangedHandle.Reset();
 	}
+
+	if (HealthChangedHandle.IsValid())
+	{
+		AbilitySystemComponent
+			->GetGameplayAttributeValueChangeDelegate(UAG_AttributeSetBase::GetHealthAttribute())
+			.Remove(HealthChangedHandle);
+
+		HealthChangedHandle.Reset();
+	}
+
+	if (RagdollTagChangedHandle.IsValid())
+	{
+		AbilitySystemComponent->UnregisterGameplayTagEvent(RagdollTagChangedHandle, AGGameplayTags::State_Ragdoll, EGameplayTagEventType::NewOrRemoved);
+		RagdollTagChangedHandle.Reset();
+	}
+
+	if (FiringTagChangedHandle.IsValid())
+	{
+		AbilitySystemComponent->UnregisterGameplayTagEvent(FiringTagChangedHandle, AGGameplayTags::State_Firing, EGameplayTagEventType::NewOrRemoved);
+		FiringTagChangedHandle.Reset();
+	}
 }
 
 AActor* AActionGameCharacter::GetWeaponActor() const
@@ -36,7 +36,7 @@ DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
  * - Interaction / movement / startup initialization
  */
 UCLASS(Abstract)
-class AActionGameCharacter : public ACharacter, public IAbilitySystemInterface
+class ACTIONGAME_API AActionGameCharacter : public ACharacter, public IAbilitySystemInterface
 {
 	GENERATED_BODY()
 
@@ -67,6 +67,15 @@ protected:
 	/** Client-side PlayerState replication initialization */
 	virtual void OnRep_PlayerState() override;
 
+	/** Releases the PlayerState's ASC */
+	virtual void UnPossessed() override;
+
+	/** ȡ PlayerState ϵ ASCԱ Pawn Ϊ Avatar ʼ󶨻ص Possess / ͻ OnRep_PlayerState */
+	void InitAbilitySystem();
+
+	/** ص ASC Pawnޣٶдҵ ASC */
+	void UninitAbilitySystem();
+
 public:
 	// =========================================================================
 	// Input API
@@ -298,7 +307,8 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Abilities|Tags")
 	FGameplayTag RagdollStateTag;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Abilities")
+	/** AActionGamePlayerState ϵ ASCPossessͻ OnRep_PlayerState֮ǰΪ */
+	UPROPERTY(Transient)
 	TObjectPtr<UAG_AbilitySystemComponentBase> AbilitySystemComponent;
 
 	UPROPERTY(Transient)
@@ -335,6 +345,9 @@ protected:
 	// =========================================================================
 
 	FDelegateHandle MaxJumpCountChangedHandle;
+	FDelegateHandle HealthChangedHandle;
+	FDelegateHandle RagdollTagChangedHandle;
+	FDelegateHandle FiringTagChangedHandle;
 
 private:
 	// =========================================================================
@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ActionGameCollisionChannels.h"
+
+#include "ActionGame.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+
+namespace
+{
+	struct FAGChannelDesc
+	{
+		const TCHAR* Name;			// DefaultEngine.ini еͨ
+		bool bTraceType;			// Trace ͨ Object ͨ
+		ECollisionChannel Fallback;	// ʧʱʹ
+	};
+
+	// ˳ EAGCollisionChannel һ
+	const FAGChannelDesc ChannelDescs[] =
+	{
+		{ TEXT("WeaponTrace"),		true,	ECC_Visibility },
+		{ TEXT("Interact_Pickup"),	true,	ECC_Visibility },
+		{ TEXT("Interact_Use"),		true,	ECC_Visibility },
+		{ TEXT("SoftCollision"),	false,	ECC_WorldDynamic },
+		{ TEXT("WorldStatic"),		false,	ECC_WorldStatic },
+		{ TEXT("Pawn"),				false,	ECC_Pawn },
+	};
+
+	static_assert(UE_ARRAY_COUNT(ChannelDescs) == static_cast<uint8>(EAGCollisionChannel::Count),
+		"ChannelDescs must match EAGCollisionChannel");
+}
+
+ECollisionChannel FAGCollisionChannels::Channels[static_cast<uint8>(EAGCollisionChannel::Count)] =
+{
+	ECC_Visibility, ECC_Visibility, ECC_Visibility, ECC_WorldDynamic, ECC_WorldStatic, ECC_Pawn
+};
+bool FAGCollisionChannels::bResolved = false;
+FDelegateHandle FAGCollisionChannels::WorldInitHandle;
+
+void FAGCollisionChannels::Initialize()
+{
+	Resolve();
+
+	WorldInitHandle = FWorldDelegates::OnPostWorldInitialization.AddLambda(
+		[](UWorld*, const UWorld::InitializationValues)
+		{
+			Resolve();
+		});
+}
+
+void FAGCollisionChannels::Shutdown()
+{
+	FWorldDelegates::OnPostWorldInitialization.Remove(WorldInitHandle);
+	WorldInitHandle.Reset();
+	bResolved = false;
+}
+
+void FAGCollisionChannels::Resolve()
+{
+	const UCollisionProfile* Profile = UCollisionProfile::Get();
+	if (!Profile)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(ChannelDescs); ++i)
+	{
+		const FAGChannelDesc& Desc = ChannelDescs[i];
+		Channels[i] = Desc.Fallback;
+
+		FName ChannelName(Desc.Name);
+		const int32 Index = Profile->ReturnContainerIndexFromChannelName(ChannelName);
+		if (Index == INDEX_NONE)
+		{
+			UE_LOG(LogActionGame, Error,
+				TEXT("Collision channel '%s' is not defined in DefaultEngine.ini [/Script/Engine.CollisionProfile] (fallback to %d)"),
+				Desc.Name, (int32)Desc.Fallback);
+			continue;
+		}
+
+		const ECollisionChannel Channel = static_cast<ECollisionChannel>(Index);
+		const bool bIsTrace = Profile->ConvertToTraceType(Channel) != TraceTypeQuery_MAX;
+		if (bIsTrace != Desc.bTraceType)
+		{
+			UE_LOG(LogActionGame, Error,
+				TEXT("Collision channel '%s' should be a %s channel but is configured as %s (fallback to %d)"),
+				Desc.Name,
+				Desc.bTraceType ? TEXT("Trace") : TEXT("Object"),
+				bIsTrace ? TEXT("Trace") : TEXT("Object"),
+				(int32)Desc.Fallback);
+			continue;
+		}
+
+		Channels[i] = Channel;
+	}
+
+	bResolved = true;
+}
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+/** Ϸõľײͨ */
+enum class EAGCollisionChannel : uint8
+{
+	WeaponTrace,	//  (Trace)
+	InteractPickup,	// ʰȡｻ (Trace)
+	InteractUse,	// ȿʹｻ (Trace)
+	SoftCollision,	// ײ (Object)
+	Footstep,		// Ų (Object)
+	Damageable,		// ˺Ľɫ (Object)
+
+	Count
+};
+
+/**
+ * ģ鼶ײͨע
+ * ʱ DefaultEngine.ini ͨһΣ֮ѯ O(1) 
+ * ȱʧͲTrace/Objectʱӡ˻صȫĬͨ
+ */
+struct ACTIONGAME_API FAGCollisionChannels
+{
+	/** ģʱãһΣÿ World ʼʱ½༭ײú PIE Ч */
+	static void Initialize();
+	static void Shutdown();
+
+	/** ½ͨ */
+	static void Resolve();
+
+	static ECollisionChannel Get(EAGCollisionChannel Channel)
+	{
+		// CDO ģ StartupModule
+		if (!bResolved)
+		{
+			Resolve();
+		}
+		return Channels[static_cast<uint8>(Channel)];
+	}
+
+	static ECollisionChannel WeaponTrace() { return Get(EAGCollisionChannel::WeaponTrace); }
+	static ECollisionChannel InteractPickup() { return Get(EAGCollisionChannel::InteractPickup); }
+	static ECollisionChannel InteractUse() { return Get(EAGCollisionChannel::InteractUse); }
+	static ECollisionChannel SoftCollision() { return Get(EAGCollisionChannel::SoftCollision); }
+	static ECollisionChannel Footstep() { return Get(EAGCollisionChannel::Footstep); }
+	static ECollisionChannel Damageable() { return Get(EAGCollisionChannel::Damageable); }
+
+private:
+	static ECollisionChannel Channels[static_cast<uint8>(EAGCollisionChannel::Count)];
+	static bool bResolved;
+	static FDelegateHandle WorldInitHandle;
+};
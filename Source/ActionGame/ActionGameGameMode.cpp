@@ -7,6 +7,7 @@
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "ActionGameGameState.h"
+#include "ActionGamePlayerState.h"
 
 AActionGameGameMode::AActionGameGameMode()
 {
@@ -14,6 +15,7 @@ AActionGameGameMode::AActionGameGameMode()
 	PrimaryActorTick.bStartWithTickEnabled = true;
 
 	GameStateClass = AActionGameGameState::StaticClass();
+	PlayerStateClass = AActionGamePlayerState::StaticClass();
 }
 
 void AActionGameGameMode::BeginPlay()
@@ -2,6 +2,7 @@
 
 #include "Net/UnrealNetwork.h"
 #include "Engine/World.h"
+#include "DataAssets/DifficultyCurveDataAsset.h"
 
 AActionGameGameState::AActionGameGameState()
 {
@@ -14,6 +15,13 @@ AActionGameGameState::AActionGameGameState()
 	bReplicates = true;
 }
 
+// Ѷȱʲ
+FDifficultyStageScales AActionGameGameState::GetStageScales(int32 Stage) const
+{
+	const UDifficultyCurveDataAsset* Curve = DifficultyCurve ? DifficultyCurve.Get() : GetDefault<UDifficultyCurveDataAsset>();
+	return Curve->GetStageScales(Stage);
+}
+
 // Ȩõǰʱ䣬׶
 void AActionGameGameState::SetElapsedSurvivalTime(float InElapsedTime)
 {
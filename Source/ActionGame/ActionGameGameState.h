@@ -4,6 +4,9 @@
 #include "GameFramework/GameStateBase.h"
 #include "ActionGameGameState.generated.h"
 
+class UDifficultyCurveDataAsset;
+struct FDifficultyStageScales;
+
 /**
  * ȫϷ״̬
  * - 浱ǰʱ
@@ -32,6 +35,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Difficulty")
 	float GetStageDuration() const { return StageDuration; }
 
+	/** ѶȱʲO(1)û DifficultyCurve ʱʹĬ */
+	FDifficultyStageScales GetStageScales(int32 Stage) const;
+
+	FDifficultyStageScales GetCurrentStageScales() const { return GetStageScales(DifficultyStage); }
+
 	// =========================
 	// Server Write API
 	// Լֻ
@@ -61,6 +69,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Difficulty", meta = (ClampMin = "1.0"))
 	float StageDuration;
 
+	/** ׶εѪ /  /  / ˢƵʱ */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Difficulty")
+	TObjectPtr<UDifficultyCurveDataAsset> DifficultyCurve;
+
 	UFUNCTION()
 	void OnRep_ElapsedSurvivalTime();
 
@@ -2,6 +2,7 @@
 
 
 #include "ActionGamePlayerController.h"
+#include "ActionGameplayTags.h"
 #include "EnhancedInputSubsystems.h"
 #include "Engine/LocalPlayer.h"
 #include "InputMappingContext.h"
@@ -73,21 +74,23 @@ void AActionGamePlayerController::OnPossess(APawn* InPawn)
 
 	if (UAbilitySystemComponent* AbilityComponent = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(InPawn))
 	{
-		DeathStateTagDelegate = AbilityComponent->RegisterGameplayTagEvent(FGameplayTag::RequestGameplayTag(TEXT("State.Dead")), EGameplayTagEventType::NewOrRemoved).AddUObject(this, &AActionGamePlayerController::OnPawnDeathStateChanged);
+		DeathStateTagDelegate = AbilityComponent->RegisterGameplayTagEvent(AGGameplayTags::State_Dead, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &AActionGamePlayerController::OnPawnDeathStateChanged);
 	}
 }
 
 void AActionGamePlayerController::OnUnPossess()
 {
-	Super::OnUnPossess();
-
+	// ASC  PlayerState Ͽ Pawn  Pawn  ASC ֮ǰ󣬷ÿ Possess һ
 	if (DeathStateTagDelegate.IsValid())
 	{
 		if (UAbilitySystemComponent* AbilityComponent = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetPawn()))
 		{
-			AbilityComponent->UnregisterGameplayTagEvent(DeathStateTagDelegate, FGameplayTag::RequestGameplayTag(TEXT("State.Dead")), EGameplayTagEventType::NewOrRemoved);
+			AbilityComponent->UnregisterGameplayTagEvent(DeathStateTagDelegate, AGGameplayTags::State_Dead, EGameplayTagEventType::NewOrRemoved);
 		}
+		DeathStateTagDelegate.Reset();
 	}
+
+	Super::OnUnPossess();
 }
 
 void AActionGamePlayerController::OnRep_Pawn()
@@ -115,8 +118,9 @@ void AActionGamePlayerController::OnPawnDeathStateChanged(const FGameplayTag Cal
 		{
 			if (UAbilitySystemComponent* AbilityComponent = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetPawn()))
 			{
-				AbilityComponent->UnregisterGameplayTagEvent(DeathStateTagDelegate, FGameplayTag::RequestGameplayTag(TEXT("State.Dead")), EGameplayTagEventType::NewOrRemoved);
+				AbilityComponent->UnregisterGameplayTagEvent(DeathStateTagDelegate, AGGameplayTags::State_Dead, EGameplayTagEventType::NewOrRemoved);
 			}
+			DeathStateTagDelegate.Reset();
 		}
 	}
 }
@@ -171,4 +175,9 @@ void AActionGamePlayerController::InitHUDWithPawn(APawn* InPawn)
 			HUDWidget->InitWithASC(ASC);
 		}
 	}
-}
\ No newline at end of file
+}
+
+void AActionGamePlayerController::ClientReceiveImpactCues_Implementation(const TArray<FImpactCueEvent>& Events)
+{
+	UAG_ImpactCueSubsystem::DispatchImpactCues(Events, GetPawn());
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "Subsystems/AG_ImpactCueSubsystem.h"
 #include "ActionGamePlayerController.generated.h"
 
 class UInputMappingContext;
@@ -15,7 +16,7 @@ class UPlayerHUDWidget;
  * - Exposes simple requests for Pawns to switch input states
  */
 UCLASS()
-class AActionGamePlayerController : public APlayerController
+class ACTIONGAME_API AActionGamePlayerController : public APlayerController
 {
 	GENERATED_BODY()
 
@@ -32,6 +33,14 @@ public:
 
 	virtual void BeginSpectatingState() override;
 
+	/** Ӵ·б¼ */
+	UFUNCTION(Client, Unreliable)
+	void ClientReceiveImpactCues(const TArray<FImpactCueEvent>& Events);
+	virtual void ClientReceiveImpactCues_Implementation(const TArray<FImpactCueEvent>& Events);
+
+	/**  HUD 󶨵 Pawn  ASC ASC  PlayerState ϣͻ Pawn õ ASC ٵһ */
+	void InitHUDWithPawn(APawn* InPawn);
+
 protected:
 
 	/** Default gameplay input mappings */
@@ -60,6 +69,4 @@ private:
 
 	UPROPERTY()
 	UPlayerHUDWidget* HUDWidget;
-
-	void InitHUDWithPawn(APawn* InPawn);
 };
@@ -0,0 +1,21 @@
+#include "ActionGamePlayerState.h"
+
+#include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+
+AActionGamePlayerState::AActionGamePlayerState()
+{
+	AbilitySystemComponent = CreateDefaultSubobject<UAG_AbilitySystemComponentBase>(TEXT("AbilitySystemComponent"));
+	AbilitySystemComponent->SetIsReplicated(true);
+	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
+
+	AttributeSet = CreateDefaultSubobject<UAG_AttributeSetBase>(TEXT("AttributeSet"));
+
+	// PlayerState ĬϵĸƵ̫ͣԺ GE Ҫ Pawn һʱ
+	SetNetUpdateFrequency(100.f);
+}
+
+UAbilitySystemComponent* AActionGamePlayerState::GetAbilitySystemComponent() const
+{
+	return AbilitySystemComponent;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PlayerState.h"
+#include "AbilitySystemInterface.h"
+#include "ActionGamePlayerState.generated.h"
+
+class UAbilitySystemComponent;
+class UAG_AbilitySystemComponentBase;
+class UAG_AttributeSetBase;
+
+/**
+ * ״̬
+ * - ҵ ASC ԼڸҶ Pawn
+ * - ʱ Pawn ֻǻ Avatar¼Ability ʱ Effect ֻ
+ * - һ״̬˺Ʒȴ Avatar ʱ ASC 
+ */
+UCLASS()
+class ACTIONGAME_API AActionGamePlayerState : public APlayerState, public IAbilitySystemInterface
+{
+	GENERATED_BODY()
+
+public:
+	AActionGamePlayerState();
+
+	/** IAbilitySystemInterface */
+	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
+
+	UAG_AbilitySystemComponentBase* GetAGAbilitySystemComponent() const { return AbilitySystemComponent; }
+
+	UAG_AttributeSetBase* GetAttributeSet() const { return AttributeSet; }
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "Abilities")
+	TObjectPtr<UAG_AbilitySystemComponentBase> AbilitySystemComponent;
+
+	UPROPERTY()
+	TObjectPtr<UAG_AttributeSetBase> AttributeSet;
+};
@@ -71,6 +71,18 @@ struct FAbilitySetData
 	TArray<TSubclassOf<class UGameplayAbility>> Abilities;
 };
 
+/** ˺Դ / Ͷͣ EffectContext  1 ֽͬ */
+UENUM(BlueprintType)
+enum class EAGDamageArchetype : uint8
+{
+	None,
+	PrimaryWeapon,
+	SecondaryWeapon,
+	Ultimate,
+	EnemyProjectile,
+	Explosion
+};
+
 UENUM(BlueprintType)
 enum class EEnemyMovementType : uint8
 {
@@ -179,6 +191,14 @@ enum class EAbilityInputID : uint8
 	Skill4 UMETA(DisplayName = "Skill4")
 };
 
+// ԶƶģʽMOVE_Custom ģʽ
+UENUM(BlueprintType)
+enum class ECustomMovementMode : uint8
+{
+	CMOVE_None UMETA(Hidden),
+	CMOVE_Dash UMETA(DisplayName = "Dash")
+};
+
 UENUM(BlueprintType)
 enum class EAbilityType : uint8
 {
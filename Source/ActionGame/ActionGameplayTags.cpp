@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ActionGameplayTags.h"
+
+namespace AGGameplayTags
+{
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Dead, "State.Dead", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Ragdoll, "State.Ragdoll", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Firing, "State.Firing", "");
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Damage, "Data.Damage", "˺");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_CD_PrimaryAttack, "Data.CD.PrimaryAttack", "չȴʱ");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Cost_Gold, "Data.Cost.Gold", "ģ");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Reward_Gold, "Data.Reward.Gold", "ҽ");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Item_Stack, "Data.Item.Stack", "߶ѵ");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Init_Health, "Data.Init.Health", "˳ʼѪ");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Init_MaxHealth, "Data.Init.MaxHealth", "˳ʼѪ");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Init_AttackPower, "Data.Init.AttackPower", "˳ʼ");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Init_AttackMultiplier, "Data.Init.AttackMultiplier", "˳ʼ");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Init_BountyGold, "Data.Init.BountyGold", "ͽ");
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Cooldown_PrimaryAttack, "Cooldown.PrimaryAttack", "չȴ");
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Damage_Immediate, "Damage.Immediate", "˺ϲ");
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Event_Combat_Shoot, "Event.Combat.Shoot", "𶯻֪ͨ");
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(GameplayCue_Weapon_Impact, "GameplayCue.Weapon.Impact", "");
+}
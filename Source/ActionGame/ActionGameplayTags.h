@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+
+/**
+ * ģ鼶ԭ GameplayTag ע
+ * C++ õ Tag ȫģʱעᣬʱַٰ
+ * Զ ActionGame.Tags.NoStringTagLookups ģԴû RequestGameplayTag
+ */
+namespace AGGameplayTags
+{
+	// ״̬
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Dead);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Ragdoll);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Firing);
+
+	// SetByCaller
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Damage);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_CD_PrimaryAttack);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Cost_Gold);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Reward_Gold);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Item_Stack);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Init_Health);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Init_MaxHealth);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Init_AttackPower);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Init_AttackMultiplier);
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Init_BountyGold);
+
+	// ȴ
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_PrimaryAttack);
+
+	// ˺
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Damage_Immediate);
+
+	// ¼
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Event_Combat_Shoot);
+
+	// GameplayCue
+	ACTIONGAME_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GameplayCue_Weapon_Impact);
+}
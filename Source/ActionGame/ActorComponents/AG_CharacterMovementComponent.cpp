@@ -3,13 +3,31 @@
 
 #include "ActorComponents/AG_CharacterMovementComponent.h"
 
+#include "ActionGame.h"
+#include "ActionGameTypes.h"
 #include "AbilitySystemInterface.h"
 #include "GameFramework/Character.h"
 #include "AbilitySystemComponent.h"
+#include "GameplayEffectTypes.h"
 #include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Move Corrections"), STAT_AG_MoveCorrections, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Move Corrections (Total)"), STAT_AG_MoveCorrectionsTotal, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dashes Started"), STAT_AG_DashesStarted, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Move Speed Cache Refreshes"), STAT_AG_MoveSpeedCacheRefreshes, STATGROUP_ActionGame);
+DECLARE_CYCLE_STAT(TEXT("CMC PerformMovement"), STAT_AG_PerformMovement, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarMoveCacheAttributes(
+	TEXT("ag.Move.CacheAttributes"),
+	1,
+	TEXT("Use attribute-derived movement values cached on change (0 = read attributes every GetMaxSpeed call)"),
+	ECVF_Default
+);
+
 UAG_CharacterMovementComponent::UAG_CharacterMovementComponent()
 {
+	bWantsToSprint = false;
+	bWantsToDash = false;
 }
 
 void UAG_CharacterMovementComponent::BeginPlay()
@@ -19,25 +37,56 @@ void UAG_CharacterMovementComponent::BeginPlay()
 	CachedAbilitySystem();
 }
 
+void UAG_CharacterMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindAttributeDelegates();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAG_CharacterMovementComponent::PerformMovement(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AG_PerformMovement);
+
+	Super::PerformMovement(DeltaTime);
+}
+
 float UAG_CharacterMovementComponent::GetMaxSpeed() const
 {
-	float BaseSpeed = Super::GetMaxSpeed();
+	if (IsDashing())
+	{
+		return DashSpeed;
+	}
 
 	if (!CachedAttributeSet)
 	{
-		return BaseSpeed;
+		return Super::GetMaxSpeed();
 	}
 
-	const float BaseMoveSpeed = CachedAttributeSet->GetBaseMoveSpeed();
-
-	const float SpeedMultiplier = CachedAttributeSet->GetMoveSpeedMultiplier();
+	float AttributeSpeed = CachedAttributeMoveSpeed;
+	if (AttributeSpeed < 0.f || CVarMoveCacheAttributes.GetValueOnGameThread() == 0)
+	{
+		AttributeSpeed = CachedAttributeSet->GetBaseMoveSpeed() * CachedAttributeSet->GetMoveSpeedMultiplier();
+	}
 
-	return BaseMoveSpeed * SpeedMultiplier;
+	// / Move 룬Ը
+	float StateMultiplier = 1.f;
+	if (IsCrouching())
+	{
+		StateMultiplier = CrouchSpeedMultiplier;
+	}
+	else if (IsSprinting())
+	{
+		StateMultiplier = SprintSpeedMultiplier;
+	}
 
+	return AttributeSpeed * StateMultiplier;
 }
 
 void UAG_CharacterMovementComponent::CachedAbilitySystem()
 {
+	UnbindAttributeDelegates();
+
 	CachedASC = nullptr;
 	CachedAttributeSet = nullptr;
 
@@ -52,4 +101,313 @@ void UAG_CharacterMovementComponent::CachedAbilitySystem()
 			CachedAttributeSet = CachedASC->GetSet<UAG_AttributeSetBase>();
 		}
 	}
+
+	BindAttributeDelegates();
+}
+
+/* ---------- Ի ---------- */
+
+void UAG_CharacterMovementComponent::BindAttributeDelegates()
+{
+	if (!CachedASC || !CachedAttributeSet)
+	{
+		return;
+	}
+
+	BaseMoveSpeedChangedHandle = CachedASC
+		->GetGameplayAttributeValueChangeDelegate(UAG_AttributeSetBase::GetBaseMoveSpeedAttribute())
+		.AddUObject(this, &UAG_CharacterMovementComponent::OnMoveSpeedAttributeChanged);
+
+	MoveSpeedMultiplierChangedHandle = CachedASC
+		->GetGameplayAttributeValueChangeDelegate(UAG_AttributeSetBase::GetMoveSpeedMultiplierAttribute())
+		.AddUObject(this, &UAG_CharacterMovementComponent::OnMoveSpeedAttributeChanged);
+
+	RefreshAttributeMoveSpeed();
+}
+
+void UAG_CharacterMovementComponent::UnbindAttributeDelegates()
+{
+	if (CachedASC)
+	{
+		if (BaseMoveSpeedChangedHandle.IsValid())
+		{
+			CachedASC->GetGameplayAttributeValueChangeDelegate(UAG_AttributeSetBase::GetBaseMoveSpeedAttribute())
+				.Remove(BaseMoveSpeedChangedHandle);
+		}
+
+		if (MoveSpeedMultiplierChangedHandle.IsValid())
+		{
+			CachedASC->GetGameplayAttributeValueChangeDelegate(UAG_AttributeSetBase::GetMoveSpeedMultiplierAttribute())
+				.Remove(MoveSpeedMultiplierChangedHandle);
+		}
+	}
+
+	BaseMoveSpeedChangedHandle.Reset();
+	MoveSpeedMultiplierChangedHandle.Reset();
+	CachedAttributeMoveSpeed = -1.f;
+}
+
+void UAG_CharacterMovementComponent::OnMoveSpeedAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	RefreshAttributeMoveSpeed();
+}
+
+void UAG_CharacterMovementComponent::RefreshAttributeMoveSpeed()
+{
+	if (!CachedAttributeSet)
+	{
+		CachedAttributeMoveSpeed = -1.f;
+		return;
+	}
+
+	CachedAttributeMoveSpeed = CachedAttributeSet->GetBaseMoveSpeed() * CachedAttributeSet->GetMoveSpeedMultiplier();
+	INC_DWORD_STAT(STAT_AG_MoveSpeedCacheRefreshes);
+}
+
+/* ----------  ---------- */
+
+void UAG_CharacterMovementComponent::SetSprinting(bool bNewSprinting)
+{
+	if (CharacterOwner && CharacterOwner->IsLocallyControlled())
+	{
+		bWantsToSprint = bNewSprinting;
+	}
+}
+
+bool UAG_CharacterMovementComponent::IsSprinting() const
+{
+	return bWantsToSprint && IsMovingOnGround();
+}
+
+/* ----------  ---------- */
+
+void UAG_CharacterMovementComponent::RequestDash()
+{
+	// ϵԶ˽ɫ FLAG_Custom_1 ֻؿƶ
+	if (CharacterOwner && CharacterOwner->IsLocallyControlled())
+	{
+		bWantsToDash = true;
+	}
+}
+
+bool UAG_CharacterMovementComponent::IsDashing() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(ECustomMovementMode::CMOVE_Dash);
+}
+
+bool UAG_CharacterMovementComponent::CanDash() const
+{
+	return UpdatedComponent && !IsDashing() && !IsCrouching() && (IsMovingOnGround() || IsFalling());
+}
+
+void UAG_CharacterMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+	// ͻԤ⡢ִСطŶ֤һ
+	if (bWantsToDash)
+	{
+		if (CanDash())
+		{
+			StartDash();
+		}
+
+		bWantsToDash = false;
+	}
+}
+
+void UAG_CharacterMovementComponent::StartDash()
+{
+	// ֻȡ Move ڵݣٶ/򣩣طʱһ
+	FVector Direction = GetCurrentAcceleration().GetSafeNormal2D();
+	if (Direction.IsNearlyZero())
+	{
+		Direction = UpdatedComponent->GetForwardVector().GetSafeNormal2D();
+	}
+
+	Velocity = Direction * DashSpeed;
+	DashTimeRemaining = DashDuration;
+
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(ECustomMovementMode::CMOVE_Dash));
+
+	INC_DWORD_STAT(STAT_AG_DashesStarted);
+}
+
+void UAG_CharacterMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
+{
+	if (CustomMovementMode == static_cast<uint8>(ECustomMovementMode::CMOVE_Dash))
+	{
+		PhysDash(deltaTime, Iterations);
+		return;
+	}
+
+	Super::PhysCustom(deltaTime, Iterations);
+}
+
+void UAG_CharacterMovementComponent::PhysDash(float deltaTime, int32 Iterations)
+{
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	const float TimeTick = FMath::Min(deltaTime, DashTimeRemaining);
+	const float RemainingTime = deltaTime - TimeTick;
+	DashTimeRemaining -= TimeTick;
+
+	// ڼٶȺ㶨롢ĦӰ
+	const FVector Delta = Velocity * TimeTick;
+
+	FHitResult Hit(1.f);
+	SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+	if (Hit.IsValidBlockingHit())
+	{
+		HandleImpact(Hit, TimeTick, Delta);
+		SlideAlongSurface(Delta, 1.f - Hit.Time, Hit.Normal, Hit, true);
+	}
+
+	if (DashTimeRemaining > 0.f)
+	{
+		return;
+	}
+
+	// ص䣬ʣʱ佻ģʽ
+	DashTimeRemaining = 0.f;
+	Velocity *= DashExitSpeedScale;
+
+	FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, false);
+	SetMovementMode(CurrentFloor.IsWalkableFloor() ? MOVE_Walking : MOVE_Falling);
+
+	StartNewPhysics(RemainingTime, Iterations);
+}
+
+/* ---------- Ԥ ---------- */
+
+void UAG_CharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToSprint = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	bWantsToDash = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+}
+
+FNetworkPredictionData_Client* UAG_CharacterMovementComponent::GetPredictionData_Client() const
+{
+	if (ClientPredictionData == nullptr)
+	{
+		UAG_CharacterMovementComponent* MutableThis = const_cast<UAG_CharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_AG(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+bool UAG_CharacterMovementComponent::ServerCheckClientError(
+	float ClientTimeStamp,
+	float DeltaTime,
+	const FVector& Accel,
+	const FVector& ClientLoc,
+	const FVector& RelativeClientLoc,
+	UPrimitiveComponent* ClientMovementBase,
+	FName ClientBaseBoneName,
+	uint8 ClientMovementMode)
+{
+	const bool bNeedsCorrection = Super::ServerCheckClientError(
+		ClientTimeStamp, DeltaTime, Accel, ClientLoc, RelativeClientLoc, ClientMovementBase, ClientBaseBoneName, ClientMovementMode);
+
+	if (bNeedsCorrection)
+	{
+		INC_DWORD_STAT(STAT_AG_MoveCorrections);
+		INC_DWORD_STAT(STAT_AG_MoveCorrectionsTotal);
+	}
+
+	return bNeedsCorrection;
+}
+
+/* ---------- SavedMove ---------- */
+
+void FSavedMove_AG::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToSprint = false;
+	bSavedWantsToDash = false;
+	SavedDashTimeRemaining = 0.f;
+}
+
+uint8 FSavedMove_AG::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+
+	// е flags ֽڣÿ Move Ӵ
+	if (bSavedWantsToSprint)
+	{
+		Result |= FLAG_Custom_0;
+	}
+
+	if (bSavedWantsToDash)
+	{
+		Result |= FLAG_Custom_1;
+	}
+
+	return Result;
+}
+
+bool FSavedMove_AG::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FSavedMove_AG* NewAGMove = static_cast<const FSavedMove_AG*>(NewMove.Get());
+
+	if (bSavedWantsToSprint != NewAGMove->bSavedWantsToSprint)
+	{
+		return false;
+	}
+
+	// ʼ֡ͳ̹̲ϲ֤ͬʱƬط
+	if (bSavedWantsToDash != NewAGMove->bSavedWantsToDash)
+	{
+		return false;
+	}
+
+	if (SavedDashTimeRemaining > 0.f || NewAGMove->SavedDashTimeRemaining > 0.f)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_AG::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const UAG_CharacterMovementComponent* MoveComp = Cast<UAG_CharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		bSavedWantsToSprint = MoveComp->bWantsToSprint;
+		bSavedWantsToDash = MoveComp->bWantsToDash;
+		SavedDashTimeRemaining = MoveComp->DashTimeRemaining;
+	}
+}
+
+void FSavedMove_AG::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	// طţָ Move ʼʱĳ״̬
+	if (UAG_CharacterMovementComponent* MoveComp = Cast<UAG_CharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		MoveComp->bWantsToSprint = bSavedWantsToSprint;
+		MoveComp->bWantsToDash = bSavedWantsToDash;
+		MoveComp->DashTimeRemaining = SavedDashTimeRemaining;
+	}
+}
+
+FNetworkPredictionData_Client_AG::FNetworkPredictionData_Client_AG(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_AG::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_AG());
 }
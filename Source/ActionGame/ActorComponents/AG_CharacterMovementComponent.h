@@ -9,25 +9,152 @@
 
 class UAbilitySystemComponent;
 class UAG_AttributeSetBase;
+struct FOnAttributeChangeData;
 
 UCLASS()
 class ACTIONGAME_API UAG_CharacterMovementComponent : public UCharacterMovementComponent
 {
 	GENERATED_BODY()
-	
+
+	friend class FSavedMove_AG;
+
 public:
 	UAG_CharacterMovementComponent();
 
 	virtual float GetMaxSpeed() const override;
 
+	/* ----------  ---------- */
+	/** ؿƶüͼÿ Move  FLAG_Custom_0  */
+	void SetSprinting(bool bNewSprinting);
+
+	UFUNCTION(BlueprintPure, Category = "Movement|Sprint")
+	bool IsSprinting() const;
+
+	/* ----------  ---------- */
+	/** ؿƶ̣һ Move  FLAG_Custom_1  */
+	void RequestDash();
+
+	UFUNCTION(BlueprintPure, Category = "Movement|Dash")
+	bool IsDashing() const;
+
+	float GetDashDuration() const { return DashDuration; }
+
+	/* ---------- Ԥ ---------- */
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+
+	/** ȡ Owner  ASC Լ ASC  PlayerState ϣɫõ /  ASC ʱ */
+	void CachedAbilitySystem();
+
 protected:
 	virtual void BeginPlay()override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** ֻһʱڶԱԻǰƶ */
+	virtual void PerformMovement(float DeltaTime) override;
+
+	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+
+	virtual void PhysCustom(float deltaTime, int32 Iterations) override;
+
+	/** Уͻλãֻһݾ */
+	virtual bool ServerCheckClientError(
+		float ClientTimeStamp,
+		float DeltaTime,
+		const FVector& Accel,
+		const FVector& ClientLoc,
+		const FVector& RelativeClientLoc,
+		UPrimitiveComponent* ClientMovementBase,
+		FName ClientBaseBoneName,
+		uint8 ClientMovementMode) override;
+
+	bool CanDash() const;
+
+	void StartDash();
+
+	void PhysDash(float deltaTime, int32 Iterations);
+
 	UPROPERTY()
 	UAbilitySystemComponent* CachedASC;
 
 	UPROPERTY()
 	const UAG_AttributeSetBase* CachedAttributeSet;
 
-	void CachedAbilitySystem();
+	/* ---------- Ի ---------- */
+	// GetMaxSpeed ÿ Move / Ӳãطſͻ Move ʱҲã
+	// ÿζˣΪԱ仯صʱˢ
+	// Ԥ GE عʱͬᴥص˻طʱֵʵʱȡһ
+
+	void BindAttributeDelegates();
+
+	void UnbindAttributeDelegates();
+
+	void OnMoveSpeedAttributeChanged(const FOnAttributeChangeData& Data);
+
+	void RefreshAttributeMoveSpeed();
+
+	/** BaseMoveSpeed * MoveSpeedMultiplier< 0 ʾûԼ */
+	float CachedAttributeMoveSpeed = -1.f;
+
+	FDelegateHandle BaseMoveSpeedChangedHandle;
+	FDelegateHandle MoveSpeedMultiplierChangedHandle;
+
+	// Ԥڵٶƶģﰴ Move 㣬һ
+	// ԣBaseMoveSpeed * MoveSpeedMultiplierǷԤBuff/٣Դ
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Sprint")
+	float SprintSpeedMultiplier = 1.5f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Crouch")
+	float CrouchSpeedMultiplier = 0.5f;
+
+	/** ǣѹ FLAG_Custom_0 */
+	uint8 bWantsToSprint : 1;
+
+	// Dash
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Dash")
+	float DashSpeed = 2000.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Dash")
+	float DashDuration = 0.2f;
+
+	/** ̽ٶȱ */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Dash")
+	float DashExitSpeedScale = 0.3f;
+
+	/** ǣѹ FLAG_Custom_1Ѻ */
+	uint8 bWantsToDash : 1;
+
+	/** ʣʱ䣬 SavedMove /ط */
+	float DashTimeRemaining = 0.f;
+};
+
+/** ״̬ SavedMove */
+class ACTIONGAME_API FSavedMove_AG : public FSavedMove_Character
+{
+	using Super = FSavedMove_Character;
+
+public:
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+
+	uint8 bSavedWantsToSprint : 1;
+
+	uint8 bSavedWantsToDash : 1;
+
+	float SavedDashTimeRemaining = 0.f;
+};
+
+class FNetworkPredictionData_Client_AG : public FNetworkPredictionData_Client_Character
+{
+	using Super = FNetworkPredictionData_Client_Character;
+
+public:
+	FNetworkPredictionData_Client_AG(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
 };
@@ -0,0 +1,158 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ActorComponents/AG_EnemyCombatComponent.h"
+
+#include "ActionGame.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Net/UnrealNetwork.h"
+#include "Engine/World.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+#include "Characters/EnemyCharacterBase.h"
+#include "Subsystems/AG_DeathQueueSubsystem.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Lite Enemy Damage Events"), STAT_AG_LiteEnemyDamage, STATGROUP_ActionGame);
+
+UAG_EnemyCombatComponent::UAG_EnemyCombatComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+UAG_EnemyCombatComponent* UAG_EnemyCombatComponent::FindForActor(const AActor* Actor)
+{
+	return Actor ? Actor->FindComponentByClass<UAG_EnemyCombatComponent>() : nullptr;
+}
+
+void UAG_EnemyCombatComponent::InitAttributes(float InHealth, float InMaxHealth, float InAttackPower, float InAttackMultiplier, float InBountyGold)
+{
+	MaxHealth = InMaxHealth;
+	Health = FMath::Clamp(InHealth, 0.f, MaxHealth);
+	AttackPower = InAttackPower;
+	AttackMultiplier = InAttackMultiplier;
+	BountyGold = InBountyGold;
+
+	SetStateFlags(0);
+}
+
+/* ---------- ˺ ---------- */
+
+void UAG_EnemyCombatComponent::ApplyGameplayDamage(float SetByCallerMagnitude, const FGameplayEffectContextHandle& Context)
+{
+	// Data.Damage ԼΪ
+	ApplyDamage(-SetByCallerMagnitude, Context.GetInstigator());
+}
+
+void UAG_EnemyCombatComponent::ApplyGameplayEffectSpec(const FGameplayEffectSpec& Spec, const FGameplayTag& DataTag)
+{
+	ApplyGameplayDamage(Spec.GetSetByCallerMagnitude(DataTag, false, 0.f), Spec.GetEffectContext());
+}
+
+void UAG_EnemyCombatComponent::ApplyDamage(float Damage, AActor* Instigator)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || IsDead() || Damage <= 0.f)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_AG_LiteEnemyDamage);
+
+	Health = FMath::Max(0.f, Health - Damage);
+
+	if (Health <= 0.f)
+	{
+		HandleDeath(Instigator);
+	}
+}
+
+/* ----------  ---------- */
+
+void UAG_EnemyCombatComponent::HandleDeath(AActor* Killer)
+{
+	SetStateFlags(StateFlags | static_cast<uint8>(EEnemyCombatState::Dead | EEnemyCombatState::Ragdoll));
+
+	GrantBounty(Killer);
+
+	OnDeath.Broadcast(Killer);
+}
+
+void UAG_EnemyCombatComponent::GrantBounty(AActor* Killer) const
+{
+	const AEnemyCharacterBase* Enemy = Cast<AEnemyCharacterBase>(GetOwner());
+	const TSubclassOf<UGameplayEffect> RewardEffect = Enemy ? Enemy->GetRewardEffectClass() : nullptr;
+	if (!Killer || !RewardEffect)
+	{
+		return;
+	}
+
+	// һɱߺϲ֡ĩ
+	if (UAG_DeathQueueSubsystem* DeathQueue = GetWorld() ? GetWorld()->GetSubsystem<UAG_DeathQueueSubsystem>() : nullptr)
+	{
+		DeathQueue->AddBounty(Killer, RewardEffect, BountyGold, GetOwner());
+		return;
+	}
+
+	UAbilitySystemComponent* KillerASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Killer);
+	if (!KillerASC)
+	{
+		return;
+	}
+
+	FGameplayEffectContextHandle RewardCtx = KillerASC->MakeEffectContext();
+	RewardCtx.AddSourceObject(GetOwner());
+
+	FGameplayEffectSpecHandle RewardSpec =
+		UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(KillerASC, RewardEffect, 1.f, RewardCtx);
+	if (!RewardSpec.IsValid())
+	{
+		return;
+	}
+
+	RewardSpec.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Reward_Gold, BountyGold);
+	KillerASC->ApplyGameplayEffectSpecToSelf(*RewardSpec.Data.Get());
+}
+
+/* ---------- ״̬ ---------- */
+
+bool UAG_EnemyCombatComponent::HasStateTag(const FGameplayTag& Tag) const
+{
+	if (Tag == AGGameplayTags::State_Dead)
+	{
+		return EnumHasAnyFlags(GetState(), EEnemyCombatState::Dead);
+	}
+
+	if (Tag == AGGameplayTags::State_Ragdoll)
+	{
+		return EnumHasAnyFlags(GetState(), EEnemyCombatState::Ragdoll);
+	}
+
+	return false;
+}
+
+void UAG_EnemyCombatComponent::SetStateFlags(uint8 NewFlags)
+{
+	if (StateFlags == NewFlags)
+	{
+		return;
+	}
+
+	StateFlags = NewFlags;
+	OnStateChanged.Broadcast(GetState());
+}
+
+void UAG_EnemyCombatComponent::OnRep_StateFlags()
+{
+	OnStateChanged.Broadcast(GetState());
+}
+
+void UAG_EnemyCombatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UAG_EnemyCombatComponent, Health);
+	DOREPLIFETIME(UAG_EnemyCombatComponent, MaxHealth);
+	DOREPLIFETIME(UAG_EnemyCombatComponent, StateFlags);
+}
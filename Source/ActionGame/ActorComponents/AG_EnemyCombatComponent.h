@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
+#include "AG_EnemyCombatComponent.generated.h"
+
+struct FGameplayEffectSpec;
+
+/** ˵״̬λ ASC ϵ State.* Tag */
+UENUM(meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EEnemyCombatState : uint8
+{
+	None = 0 UMETA(Hidden),
+	Dead = 1 << 0,
+	Ragdoll = 1 << 1,
+};
+ENUM_CLASS_FLAGS(EEnemyCombatState)
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEnemyCombatStateChanged, EEnemyCombatState /*NewState*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEnemyCombatDeath, AActor* /*Killer*/);
+
+/**
+ * սASC Ŀѡ
+ *
+ * ֻҪѪ//״̬ĴС֣
+ * - ֱӴ floatֻ Health/MaxHealth ״̬λ
+ * - ҵ GAS ˺ͨȡ SetByCaller ˺ֱֵӿѪ
+ * - ѪֱӴͽ + ޣ GA
+ *
+ * Ӣּʹ ASC
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class ACTIONGAME_API UAG_EnemyCombatComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAG_EnemyCombatComponent();
+
+	/** ڣActor û ASC ʱ */
+	static UAG_EnemyCombatComponent* FindForActor(const AActor* Actor);
+
+	/** ʱʼԣȡ Init GE */
+	void InitAttributes(float InHealth, float InMaxHealth, float InAttackPower, float InAttackMultiplier, float InBountyGold);
+
+	/* ---------- ˺ ---------- */
+
+	/**
+	 *  GAS  SetByCaller ԼѪΪ˺
+	 * ɱȡ Context  Instigator
+	 */
+	void ApplyGameplayDamage(float SetByCallerMagnitude, const FGameplayEffectContextHandle& Context);
+
+	/** ҹõ˺ Spec жȡ DataTag Ӧ SetByCaller ֵ */
+	void ApplyGameplayEffectSpec(const FGameplayEffectSpec& Spec, const FGameplayTag& DataTag);
+
+	/** ֱӿѪDamage Ϊ */
+	void ApplyDamage(float Damage, AActor* Instigator);
+
+	/* ---------- ״̬ ---------- */
+
+	bool IsDead() const { return EnumHasAnyFlags(GetState(), EEnemyCombatState::Dead); }
+
+	EEnemyCombatState GetState() const { return static_cast<EEnemyCombatState>(StateFlags); }
+
+	/**  State.Dead / State.Ragdoll ӳ䵽״̬λ Tag жϵĴ */
+	bool HasStateTag(const FGameplayTag& Tag) const;
+
+	float GetHealth() const { return Health; }
+	float GetMaxHealth() const { return MaxHealth; }
+	float GetAttackPower() const { return AttackPower; }
+	float GetAttackMultiplier() const { return AttackMultiplier; }
+	float GetBountyGold() const { return BountyGold; }
+
+	FOnEnemyCombatStateChanged OnStateChanged;
+
+	/**  */
+	FOnEnemyCombatDeath OnDeath;
+
+protected:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	void HandleDeath(AActor* Killer);
+
+	/**  GE ȡ˵ RewardEffectClass */
+	void GrantBounty(AActor* Killer) const;
+
+	void SetStateFlags(uint8 NewFlags);
+
+	UFUNCTION()
+	void OnRep_StateFlags();
+
+	UPROPERTY(Replicated)
+	float Health = 0.f;
+
+	UPROPERTY(Replicated)
+	float MaxHealth = 0.f;
+
+	// ֻڷʹã
+	float AttackPower = 0.f;
+	float AttackMultiplier = 1.f;
+	float BountyGold = 0.f;
+
+	UPROPERTY(ReplicatedUsing = OnRep_StateFlags)
+	uint8 StateFlags = 0;
+};
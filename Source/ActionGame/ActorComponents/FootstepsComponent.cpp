@@ -4,6 +4,7 @@
 #include "ActorComponents/FootstepsComponent.h"
 #include "PhysicalMaterials/AG_PhysicalMaterial.h"
 #include "ActionGameCharacter.h"
+#include "ActionGameCollisionChannels.h"
 #include "DrawDebugHelpers.h"
 #include <Kismet/GameplayStatics.h>
 
@@ -76,12 +77,12 @@ void UFootstepsComponent::HandleFootstep(EFoot Foot)
 
 	const FVector TraceEnd = Location + FVector::UpVector * -50.f;
 
-	// ECC_WorldStatic ֻ⾲̬
+	// Footstep ͨWorldStaticֻ⾲̬
 	if (World->LineTraceSingleByChannel(
 		HitResult,
 		Location,
 		TraceEnd,
-		ECC_WorldStatic,
+		FAGCollisionChannels::Footstep(),
 		QueryParam))
 	{
 		if (HitResult.bBlockingHit && HitResult.PhysMaterial.IsValid())
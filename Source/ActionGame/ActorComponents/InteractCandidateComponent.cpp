@@ -3,6 +3,32 @@
 
 #include "ActorComponents/InteractCandidateComponent.h"
 
+#include "Engine/World.h"
+#include "Subsystems/AG_InteractionSubsystem.h"
+
+void UInteractCandidateComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UAG_InteractionSubsystem* Interaction = GetWorld()->GetSubsystem<UAG_InteractionSubsystem>())
+	{
+		Interaction->RegisterCandidateComponent(this);
+	}
+}
+
+void UInteractCandidateComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UAG_InteractionSubsystem* Interaction = World->GetSubsystem<UAG_InteractionSubsystem>())
+		{
+			Interaction->UnregisterCandidateComponent(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 bool UInteractCandidateComponent::IsInteractCandidate(AActor* Actor) const
 {
 	if (!Actor)
@@ -35,7 +61,37 @@ void UInteractCandidateComponent::RemoveCandidate(AActor* Actor)
 	OnInteractCandidateChanged.Broadcast(Actor, false);
 }
 
-TSet<TWeakObjectPtr<AActor>> UInteractCandidateComponent::GetAllCandidates()
+void UInteractCandidateComponent::SetCandidates(const TArray<AActor*>& InRange)
 {
-	return InteractCandidates;
+	// Ƴڱνģٵģ
+	ScratchRemoved.Reset();
+	for (const TWeakObjectPtr<AActor>& WeakActor : InteractCandidates)
+	{
+		AActor* Actor = WeakActor.Get();
+		if (!Actor || !InRange.Contains(Actor))
+		{
+			ScratchRemoved.Add(WeakActor);
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& WeakActor : ScratchRemoved)
+	{
+		if (AActor* Actor = WeakActor.Get())
+		{
+			RemoveCandidate(Actor);
+		}
+		else
+		{
+			InteractCandidates.Remove(WeakActor);
+		}
+	}
+
+	// ½뷶Χ
+	for (AActor* Actor : InRange)
+	{
+		if (!InteractCandidates.Contains(Actor))
+		{
+			AddCandidate(Actor);
+		}
+	}
 }
@@ -21,16 +21,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Interact")
 	bool IsInteractCandidate(AActor* Actor) const;
 
-	// === άӿڣ Overlap / Scanner ã ===
+	// === άӿڣ UAG_InteractionSubsystem ã ===
 	void AddCandidate(AActor* Actor);
 	void RemoveCandidate(AActor* Actor);
 
+	// ñηΧѯĽ滻ֻ / Ƴ Actor ¼
+	void SetCandidates(const TArray<AActor*>& InRange);
+
 	FOnInteractCandidateChanged OnInteractCandidateChanged;
 
-	TSet<TWeakObjectPtr<AActor>> GetAllCandidates();
+	const TSet<TWeakObjectPtr<AActor>>& GetAllCandidates() const { return InteractCandidates; }
 
 protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// ǰѡϣãӵУ
 	UPROPERTY()
 	TSet<TWeakObjectPtr<AActor>> InteractCandidates;
+
+private:
+	// SetCandidates 
+	TArray<TWeakObjectPtr<AActor>> ScratchRemoved;
 };
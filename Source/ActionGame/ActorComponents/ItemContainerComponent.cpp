@@ -4,6 +4,7 @@
 #include "DataAssets/DA_Item.h"
 
 #include "AbilitySystemComponent.h"
+#include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
 
 #include "GameFramework/Actor.h"
@@ -23,10 +24,7 @@ void UItemContainerComponent::BeginPlay()
 
 void UItemContainerComponent::InitializeAbilitySystemComponent()
 {
-	if (AbilitySystemComponent)
-	{
-		return;
-	}
+	AbilitySystemComponent = nullptr;
 
 	AActor* OwnerActor = GetOwner();
 	if (!OwnerActor)
@@ -34,8 +32,8 @@ void UItemContainerComponent::InitializeAbilitySystemComponent()
 		return;
 	}
 
-	//  Owner ϻȡ ASCͨ Character
-	AbilitySystemComponent = OwnerActor->FindComponentByClass<UAbilitySystemComponent>();
+	//  IAbilitySystemInterface ȡ ASCҽɫ ASC  PlayerState ϣֻ Possess ڼȡ
+	AbilitySystemComponent = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(OwnerActor);
 }
 
 bool UItemContainerComponent::AddItem(UDA_Item* Item, int32 Count)
@@ -76,6 +74,7 @@ bool UItemContainerComponent::AddItem(UDA_Item* Item, int32 Count)
 	OnItemStackChanged.Broadcast(Item, NewCount);
 
 	// ֪ͨ ASC ִ Item  GAS
+	InitializeAbilitySystemComponent();
 	if (UAG_AbilitySystemComponentBase* AGASC =
 		Cast<UAG_AbilitySystemComponentBase>(AbilitySystemComponent))
 	{
@@ -121,14 +120,19 @@ bool UItemContainerComponent::RemoveItem(UDA_Item* Item, int32 Count)
 	// 㲥ѵ仯¼
 	OnItemStackChanged.Broadcast(Item, NewCount);
 
-	// ƷȫƳ֪ͨ ASC
-	if (NewCount == 0)
+	// ֪ͨ ASCʱԭظЧʱƳ
+	InitializeAbilitySystemComponent();
+	if (UAG_AbilitySystemComponentBase* AGASC =
+		Cast<UAG_AbilitySystemComponentBase>(AbilitySystemComponent))
 	{
-		if (UAG_AbilitySystemComponentBase* AGASC =
-			Cast<UAG_AbilitySystemComponentBase>(AbilitySystemComponent))
+		if (NewCount == 0)
 		{
 			AGASC->RemoveItem(Item);
 		}
+		else
+		{
+			AGASC->ApplyItem(Item, CurrentCount, NewCount);
+		}
 	}
 
 	return true;
@@ -154,6 +154,7 @@ protected:
 
 	/**
 	 *  Ownerͨ Characterлȡ ASC
+	 * ҵ ASC  PlayerState ϡ Possess 仯ÿִ Item  GAS ǰ»ȡ
 	 */
 	void InitializeAbilitySystemComponent();
 };
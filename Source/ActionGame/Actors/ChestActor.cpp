@@ -10,14 +10,13 @@
 #include "Components/SphereComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/SceneComponent.h"
-#include "Components/WidgetComponent.h"
 #include "AbilitySystem/Components/InteractableComponent.h"
 #include "UserWidget/WorldObjectPromptWidget.h"
+#include "Subsystems/AG_InteractPromptSubsystem.h"
+#include "Subsystems/AG_WorldItemFieldSubsystem.h"
 
-#include "Kismet/KismetMathLibrary.h"
-#include "Camera/PlayerCameraManager.h"
-#include "GameFramework/PlayerController.h"
 #include "DataAssets/WorldObjectDataAsset.h"
+#include "ActionGameCollisionChannels.h"
 
 #include "Net/UnrealNetwork.h"
 
@@ -26,8 +25,8 @@
 // Sets default values
 AChestActor::AChestActor()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	// ʾ UAG_InteractPromptSubsystem ͳһͶӰ䱾Ҫ Tick
+	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
 
 	// Root
@@ -44,7 +43,8 @@ AChestActor::AChestActor()
 	MeshComponent->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
 	MeshComponent->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Block);
 	MeshComponent->SetCollisionResponseToChannel(ECC_Pawn, ECR_Block);
-	MeshComponent->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block);
+	// 嵲סʰȡĽ
+	MeshComponent->SetCollisionResponseToChannel(FAGCollisionChannels::InteractPickup(), ECR_Block);
 
 	// ж
 	InteractTargetBox = CreateDefaultSubobject<UBoxComponent>(TEXT("InteractTargetBox"));
@@ -52,24 +52,10 @@ AChestActor::AChestActor()
 	// Collision
 	InteractTargetBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	InteractTargetBox->SetCollisionResponseToAllChannels(ECR_Ignore);
-	InteractTargetBox->SetCollisionResponseToChannel(ECC_GameTraceChannel2, ECR_Block);
+	InteractTargetBox->SetCollisionResponseToChannel(FAGCollisionChannels::InteractUse(), ECR_Block);
 	InteractTargetBox->ComponentTags.Add(InteractTags::InteractTarget);
 
 	InteractableComponent = CreateDefaultSubobject<UInteractableComponent>(TEXT("InteractableComponent"));
-
-
-	// UI
-	InteractWidgetComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("InteractWidget"));
-	InteractWidgetComponent->SetupAttachment(RootComponent);
-
-	// ռ UI
-	InteractWidgetComponent->SetWidgetSpace(EWidgetSpace::World);
-	InteractWidgetComponent->SetDrawSize(FVector2D(200.f, 80.f));
-	InteractWidgetComponent->SetRelativeLocation(FVector(0.f, 0.f, 120.f));
-
-	// Ĭ
-	InteractWidgetComponent->SetHiddenInGame(true);
-	InteractWidgetComponent->SetVisibility(false);
 }
 
 // Called when the game starts or when spawned
@@ -77,41 +63,22 @@ void AChestActor::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (!InteractWidgetComponent || !WorldObjectDataAsset)
-	{
-		return;
-	}
-
-	UUserWidget* Widget = InteractWidgetComponent->GetUserWidgetObject();
-	if (!Widget)
-	{
-		return;
-	}
-	UE_LOG(LogTemp, Warning, TEXT("Widget = %s"),
-		Widget ? TEXT("Valid") : TEXT("Null"));
-
-	if (UWorldObjectPromptWidget* Prompt = Cast<UWorldObjectPromptWidget>(Widget))
+	// ר÷ûиϵͳ
+	if (UAG_InteractPromptSubsystem* Prompts = GetWorld()->GetSubsystem<UAG_InteractPromptSubsystem>())
 	{
-		Prompt->InitWithData(WorldObjectDataAsset);
+		Prompts->RegisterPrompt(this, WorldObjectDataAsset, PromptWidgetClass, PromptOffset);
+		Prompts->SetPromptEnabled(this, !bOpened);
 	}
 }
 
-void AChestActor::Tick(float DeltaTime)
+void AChestActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (!InteractWidgetComponent || !InteractWidgetComponent->IsVisible())
-		return;
-
-	APlayerController* PC = GetWorld()->GetFirstPlayerController();
-	if (!PC) return;
-
-	FVector CamLoc = PC->PlayerCameraManager->GetCameraLocation();
-	FVector WidgetLoc = InteractWidgetComponent->GetComponentLocation();
-
-	FRotator LookAt = UKismetMathLibrary::FindLookAtRotation(WidgetLoc, CamLoc);
-	LookAt.Pitch = 0.f;
-	LookAt.Roll = 0.f;
+	if (UAG_InteractPromptSubsystem* Prompts = GetWorld()->GetSubsystem<UAG_InteractPromptSubsystem>())
+	{
+		Prompts->UnregisterPrompt(this);
+	}
 
-	InteractWidgetComponent->SetWorldRotation(LookAt);
+	Super::EndPlay(EndPlayReason);
 }
 
 bool AChestActor::CanInteract_Implementation(AActor* Interactor) const
@@ -192,7 +159,7 @@ void AChestActor::StartDropFlow()
 	}
 
 	// 󶨵ɻص
-	// ChestDropϸڣֻҪһɵGroundLocation
+	// ChestDropĹ켣ϸڣֻҪһɵGroundLocation
 	DropActor->BindOnDropFinished(FOnDropFinished::CreateUObject(this, &AChestActor::HandleDropLanded));
 }
 
@@ -218,18 +185,12 @@ void AChestActor::HandleDropLanded(const FVector& GroundLocation)
 		return;
 	}
 	const FVector SpawnLocation = GroundLocation + FVector(0.f, 0.f, 50.f);
-	const FRotator SpawnRotation = FRotator::ZeroRotator;
-
-	FActorSpawnParameters Params;
-	Params.Owner = this;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AWorldItemActor* ItemActor = World->SpawnActor<AWorldItemActor>(WorldItemClass, SpawnLocation, SpawnRotation, Params);
+	const int32 Index = FMath::RandRange(0, DropItems.Num() - 1);
 
-	if (ItemActor)
+	// غȽʵĵＯϣҿʱ WorldItemActor
+	if (UAG_WorldItemFieldSubsystem* ItemField = World->GetSubsystem<UAG_WorldItemFieldSubsystem>())
 	{
-		const int32 Index = FMath::RandRange(0, DropItems.Num() - 1);
-		ItemActor->InitWithItemData(DropItems[Index]);
+		ItemField->SpawnItem(DropItems[Index], SpawnLocation, WorldItemClass, this);
 	}
 }
 
@@ -249,19 +210,17 @@ void AChestActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifet
 
 void AChestActor::SetInteractUIVisible(bool bVisible)
 {
-	if (!InteractWidgetComponent)
+	UAG_InteractPromptSubsystem* Prompts = GetWorld() ? GetWorld()->GetSubsystem<UAG_InteractPromptSubsystem>() : nullptr;
+	if (!Prompts)
 	{
 		return;
 	}
 
-	if (bOpened) bVisible = false;
-
-	// UI ֻڿͻ˿ɼ
-	if (!GetWorld() || GetWorld()->IsNetMode(NM_DedicatedServer))
+	if (bOpened)
 	{
+		Prompts->SetPromptEnabled(this, false);
 		return;
 	}
 
-	InteractWidgetComponent->SetHiddenInGame(!bVisible);
-	InteractWidgetComponent->SetVisibility(bVisible);
+	Prompts->SetPromptVisible(this, bVisible);
 }
@@ -17,8 +17,7 @@ class UBoxComponent;
 class AWorldItemActor;
 class UInteractableComponent;
 class UWorldObjectDataAsset;
-class UWidgetComponent;
-class UUserWidget;
+class UWorldObjectPromptWidget;
 
 /**
  * AChestActor
@@ -71,7 +70,7 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 protected: // Interact
 
@@ -110,8 +109,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Data")
 	TObjectPtr<UWorldObjectDataAsset> WorldObjectDataAsset;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI")
-	TObjectPtr<UWidgetComponent> InteractWidgetComponent;
+	// ʾֻǼǵ UAG_InteractPromptSubsystemɿͻ˵Ļռ Widget ʾ
+	// Ϊʱʹ UAG_InteractPromptSubsystem  DefaultWidgetClassDefaultGame.ini
+	UPROPERTY(EditDefaultsOnly, Category = "UI")
+	TSubclassOf<UWorldObjectPromptWidget> PromptWidgetClass;
+
+	// ʾԱλ
+	UPROPERTY(EditDefaultsOnly, Category = "UI")
+	FVector PromptOffset = FVector(0.f, 0.f, 120.f);
 
 	// ǷѾ
 	UPROPERTY(VisibleInstanceOnly, ReplicatedUsing = OnRep_Opened, Category = "State")
@@ -3,36 +3,30 @@
 
 #include "Actors/DropVisualActor.h"
 
+#include "ActionGame.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
-#include "ChestActor.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Drop Arcs Launched"), STAT_AG_DropArcsLaunched, STATGROUP_ActionGame);
 
 // Sets default values
 ADropVisualActor::ADropVisualActor()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = false;
+	// ֻڿͻ˷ڼ Tickڲֵ
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 	bReplicates = true;
 
-	// Mesh
+	// Mesh֣ģ
 	MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Mesh"));
 	SetRootComponent(MeshComponent);
 
-	MeshComponent->SetSimulatePhysics(true);
-	MeshComponent->SetEnableGravity(true);
-	MeshComponent->SetNotifyRigidBodyCollision(true);
-
-	MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-	MeshComponent->SetCollisionObjectType(ECC_WorldDynamic);
-	MeshComponent->SetCollisionResponseToAllChannels(ECR_Ignore);
-	MeshComponent->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
-	MeshComponent->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Block);
-
-	MeshComponent->OnComponentHit.AddDynamic(
-		this,
-		&ADropVisualActor::OnMeshHit
-	);
+	MeshComponent->SetSimulatePhysics(false);
+	MeshComponent->SetEnableGravity(false);
+	MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 }
 
 // Called when the game starts or when spawned
@@ -40,20 +34,17 @@ void ADropVisualActor::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (!MeshComponent || !MeshComponent->IsSimulatingPhysics())
+	// ͼԹѡģ
+	if (MeshComponent)
 	{
-		return;
+		MeshComponent->SetSimulatePhysics(false);
+		MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	}
 
-	// ʩӳ
-	const FVector ForwardDir = GetActorForwardVector();
-	const FVector Impulse = ForwardDir * ForwardImpulse + FVector(0.f, 0.f, UpImpulse);
-	MeshComponent->WakeAllRigidBodies();
-	MeshComponent->AddImpulse(
-		Impulse,
-		NAME_None,
-		true // Velocity Change
-	);
+	if (HasAuthority())
+	{
+		LaunchArc();
+	}
 }
 
 void ADropVisualActor::BindOnDropFinished(FOnDropFinished InDelegate)
@@ -61,22 +52,121 @@ void ADropVisualActor::BindOnDropFinished(FOnDropFinished InDelegate)
 	OnDropFinished = InDelegate;
 }
 
-void ADropVisualActor::OnMeshHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+void ADropVisualActor::LaunchArc()
 {
-	UE_LOG(LogTemp, Warning, TEXT("ADropVisualActor::OnMeshHit"));
-
-	if (bDropFinished)
+	UWorld* World = GetWorld();
+	if (!World)
 	{
 		return;
 	}
 
-	if (!OtherComp || OtherActor == this)
+	INC_DWORD_STAT(STAT_AG_DropArcsLaunched);
+
+	// ԭȵٶȳһ
+	const FVector Start = GetActorLocation();
+	const FVector Velocity = GetActorForwardVector() * ForwardImpulse + FVector(0.f, 0.f, UpImpulse);
+	const float GravityZ = World->GetGravityZ() < -KINDA_SMALL_NUMBER ? World->GetGravityZ() : -980.f;
+
+	// z(t) = Start.Z + Vz * t + 0.5 * g * t^2 ½ GroundZ ʱ
+	auto SolveFallTime = [&Start, &Velocity, GravityZ](float GroundZ)
 	{
-		return;
+		const float Disc = Velocity.Z * Velocity.Z - 2.f * GravityZ * (Start.Z - GroundZ);
+		if (Disc < 0.f)
+		{
+			// ߵ㣺ȡߵ
+			return FMath::Max(0.f, -Velocity.Z / GravityZ);
+		}
+		return FMath::Max(0.f, (-Velocity.Z - FMath::Sqrt(Disc)) / GravityZ);
+	};
+
+	// ȼط߽µĸ߶ȣص XY
+	const AActor* OwnerActor = GetOwner();
+	const float BaseZ = OwnerActor ? OwnerActor->GetActorLocation().Z : Start.Z;
+	const FVector EstimatedLand = Start + Velocity * SolveFallTime(BaseZ);
+
+	// ڸ XY һֱԤ Traceߵ
+	const float ApexZ = Start.Z + FMath::Square(FMath::Max(0.f, Velocity.Z)) / (-2.f * GravityZ);
+	const FVector TraceStart(EstimatedLand.X, EstimatedLand.Y, ApexZ);
+	const FVector TraceEnd(EstimatedLand.X, EstimatedLand.Y, Start.Z - MaxDropDepth);
+
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DropArcGround), false, this);
+	QueryParams.AddIgnoredActor(OwnerActor);
+
+	FHitResult Hit;
+	const float GroundZ = World->LineTraceSingleByObjectType(Hit, TraceStart, TraceEnd, ObjectParams, QueryParams)
+		? Hit.ImpactPoint.Z
+		: BaseZ;
+
+	DropArc.Start = Start;
+	DropArc.Velocity = Velocity;
+	DropArc.GravityZ = GravityZ;
+	DropArc.Duration = SolveFallTime(GroundZ);
+	DropArc.LaunchServerTime = GetServerWorldTime();
+
+	const FVector Land = DropArc.Evaluate(DropArc.Duration);
+	DropArc.LandLocation = FVector(Land.X, Land.Y, GroundZ);
+
+	// ֱ Trace ֻص㣺߷ֶɨһ飬ײǽ / ̨ױԵʱڵһ赲ض
+	const FCollisionShape SweepShape = FCollisionShape::MakeSphere(ArcSweepRadius);
+	const int32 NumSegments = FMath::Max(1, ArcSweepSegments);
+	for (int32 Segment = 0; Segment < NumSegments; ++Segment)
+	{
+		const float SegmentStartTime = DropArc.Duration * Segment / NumSegments;
+		const float SegmentEndTime = DropArc.Duration * (Segment + 1) / NumSegments;
+
+		FHitResult ArcHit;
+		if (!World->SweepSingleByObjectType(ArcHit, DropArc.Evaluate(SegmentStartTime), DropArc.Evaluate(SegmentEndTime),
+			FQuat::Identity, ObjectParams, SweepShape, QueryParams))
+		{
+			continue;
+		}
+
+		// 䵽Ԥĵϣһ汾
+		if (ArcHit.ImpactNormal.Z > 0.7f && FMath::Abs(ArcHit.ImpactPoint.Z - GroundZ) < ArcSweepRadius + 1.f)
+		{
+			break;
+		}
+
+		DropArc.Duration = FMath::Lerp(SegmentStartTime, SegmentEndTime, ArcHit.bStartPenetrating ? 0.f : ArcHit.Time);
+
+		// ײ˻ذ뾶ֱҵ棬ǽǰ / ̨
+		const FVector StopLocation = ArcHit.bStartPenetrating
+			? DropArc.Evaluate(DropArc.Duration)
+			: ArcHit.Location + ArcHit.ImpactNormal * ArcSweepRadius;
+
+		FHitResult FloorHit;
+		const bool bFoundFloor = World->LineTraceSingleByObjectType(FloorHit, StopLocation,
+			StopLocation - FVector(0.f, 0.f, MaxDropDepth), ObjectParams, QueryParams);
+
+		DropArc.LandLocation = bFoundFloor
+			? FVector(StopLocation.X, StopLocation.Y, FloorHit.ImpactPoint.Z)
+			: FVector(StopLocation.X, StopLocation.Y, BaseZ);
+		break;
 	}
 
-	// ų Pawn / Character
-	if (OtherActor->IsA<APawn>())
+	if (DropArc.Duration > KINDA_SMALL_NUMBER)
+	{
+		World->GetTimerManager().SetTimer(LandTimerHandle, this, &ADropVisualActor::FinishDrop, DropArc.Duration, false);
+	}
+	else
+	{
+		World->GetTimerManager().SetTimerForNextTick(this, &ADropVisualActor::FinishDrop);
+	}
+
+	// ҲҪ
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		SetActorTickEnabled(true);
+	}
+}
+
+void ADropVisualActor::FinishDrop()
+{
+	if (bDropFinished)
 	{
 		return;
 	}
@@ -85,9 +175,52 @@ void ADropVisualActor::OnMeshHit(UPrimitiveComponent* HitComp, AActor* OtherActo
 
 	if (OnDropFinished.IsBound())
 	{
-		OnDropFinished.Execute(Hit.ImpactPoint);
+		OnDropFinished.Execute(DropArc.LandLocation);
 	}
 
 	Destroy();
 }
 
+void ADropVisualActor::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UpdateArcVisual();
+}
+
+void ADropVisualActor::UpdateArcVisual()
+{
+	const float Time = FMath::Clamp(GetServerWorldTime() - DropArc.LaunchServerTime, 0.f, DropArc.Duration);
+
+	SetActorLocation(DropArc.Evaluate(Time));
+
+	if (Time >= DropArc.Duration)
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+float ADropVisualActor::GetServerWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.f;
+	}
+
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? static_cast<float>(GameState->GetServerWorldTimeSeconds()) : World->GetTimeSeconds();
+}
+
+void ADropVisualActor::OnRep_DropArc()
+{
+	SetActorTickEnabled(true);
+	UpdateArcVisual();
+}
+
+void ADropVisualActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_CONDITION(ADropVisualActor, DropArc, COND_InitialOnly);
+}
@@ -14,15 +14,48 @@ class UStaticMeshComponent;
  */
 DECLARE_DELEGATE_OneParam(FOnDropFinished, const FVector&);
 
+/** ʱõߣͻ˾ݴ˲ֵ */
+USTRUCT()
+struct FDropArc
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize10 Start = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Velocity = FVector::ZeroVector;
+
+	/** ص㣨棩 */
+	UPROPERTY()
+	FVector_NetQuantize10 LandLocation = FVector::ZeroVector;
+
+	UPROPERTY()
+	float GravityZ = 0.f;
+
+	UPROPERTY()
+	float Duration = 0.f;
+
+	/** ʱķʱ */
+	UPROPERTY()
+	float LaunchServerTime = 0.f;
+
+	FVector Evaluate(float Time) const
+	{
+		return FVector(Start) + FVector(Velocity) * Time + FVector(0.f, 0.f, 0.5f * GravityZ * Time * Time);
+	}
+};
+
 /**
  * ADropVisualActor
  *
  * 壨ɫ
  *
  * ְ
- * - ŵ֣߼
- * - жϺʱɡ
- * - ֪ͨⲿChest / DropManager
+ * - ʱڷϽߣһεԤ Trace õصʱ
+ * - ߷ֶɨһ飬ײǽ / ̨ױԵʱڵһ赲ضϣ赲ǰĵ
+ * - ͻ˰ʱֵ߲֣ģ⣩
+ * - Ԥʱ֪ͨⲿChest / DropManager
  *
  * 
  * - Ʒ
@@ -40,6 +73,12 @@ public:
 
 	void BindOnDropFinished(FOnDropFinished InDelegate);
 
+	virtual void Tick(float DeltaTime) override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	const FDropArc& GetDropArc() const { return DropArc; }
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -56,8 +95,24 @@ protected:
 
 	bool bDropFinished = false;
 
+	UPROPERTY(ReplicatedUsing = OnRep_DropArc)
+	FDropArc DropArc;
+
+	FTimerHandle LandTimerHandle;
+
+	/** ߺص */
+	void LaunchArc();
+
+	/** Ԥʱ */
+	void FinishDrop();
+
+	/** ݷʱ±λãغֹͣ Tick */
+	void UpdateArcVisual();
+
+	float GetServerWorldTime() const;
+
 	UFUNCTION()
-	void OnMeshHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
+	void OnRep_DropArc();
 
 protected:
 	// 
@@ -66,4 +121,15 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, Category = "Drop|Impulse")
 	float UpImpulse = 300.f;
+
+	// Ԥ Trace ӷµ
+	UPROPERTY(EditDefaultsOnly, Category = "Drop|Arc")
+	float MaxDropDepth = 2000.f;
+
+	// ߼赲ķֶ뾶
+	UPROPERTY(EditDefaultsOnly, Category = "Drop|Arc", meta = (ClampMin = "1"))
+	int32 ArcSweepSegments = 4;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Drop|Arc", meta = (ClampMin = "0"))
+	float ArcSweepRadius = 10.f;
 };
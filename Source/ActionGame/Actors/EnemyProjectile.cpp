@@ -2,10 +2,13 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystem/AG_GameplayEffectContext.h"
 #include "Characters/EnemyCharacterBase.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "GameplayEffect.h"
+#include "Subsystems/AG_DamageAccumulatorSubsystem.h"
+#include "Subsystems/AG_ImpactCueSubsystem.h"
 
 AEnemyProjectile::AEnemyProjectile()
 {
@@ -91,6 +94,7 @@ void AEnemyProjectile::OnProjectileHit(
 	if (HasAuthority())
 	{
 		ApplyDamageIfPossible(Hit);
+		QueueImpactCue(Hit);
 	}
 
 	if (bDestroyOnHit)
@@ -114,6 +118,19 @@ void AEnemyProjectile::OnProjectileBeginOverlap(
 
 	ApplyDamageIfPossible(SweepResult);
 
+	if (bFromSweep)
+	{
+		QueueImpactCue(SweepResult);
+	}
+	else
+	{
+		//  Sweep صûϢõ嵱ǰλúͷз
+		FHitResult CueHit;
+		CueHit.ImpactPoint = GetActorLocation();
+		CueHit.ImpactNormal = MovementComp ? -MovementComp->Velocity.GetSafeNormal() : FVector::UpVector;
+		QueueImpactCue(CueHit);
+	}
+
 	if (bDestroyOnHit)
 	{
 		Destroy();
@@ -122,7 +139,7 @@ void AEnemyProjectile::OnProjectileBeginOverlap(
 
 void AEnemyProjectile::ApplyDamageIfPossible(const FHitResult& Hit)
 {
-	if (!SourceASC || !DamageEffectClass || !DamageDataTag.IsValid() || DamageValue <= 0.f)
+	if (!DamageEffectClass || !DamageDataTag.IsValid() || DamageValue <= 0.f)
 	{
 		return;
 	}
@@ -139,18 +156,36 @@ void AEnemyProjectile::ApplyDamageIfPossible(const FHitResult& Hit)
 		return;
 	}
 
-	FGameplayEffectContextHandle Context = SourceASC->MakeEffectContext();
+	// ˣ ASCĵ裺Ŀ ASC Լ SpecInstigator ԼΪ
+	UAbilitySystemComponent* SpecSourceASC = SourceASC ? SourceASC.Get() : TargetASC;
+
+	FGameplayEffectContextHandle Context = SpecSourceASC->MakeEffectContext();
+	if (!SourceASC)
+	{
+		Context.AddInstigator(GetInstigator(), this);
+	}
 	Context.AddSourceObject(this);
 	Context.AddHitResult(Hit);
+	if (FAGGameplayEffectContext* AGContext = FAGGameplayEffectContext::Get(Context))
+	{
+		AGContext->SetDamageArchetype(EAGDamageArchetype::EnemyProjectile);
+	}
+
+	// ͬһ֡ͬһĿϵĵϲһ GE
+	UAG_DamageAccumulatorSubsystem::ApplyDamage(this, SpecSourceASC, TargetASC, DamageEffectClass, 1.f, DamageDataTag, -DamageValue, Context);
+}
 
-	FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(DamageEffectClass, 1.f, Context);
-	if (!SpecHandle.IsValid())
+void AEnemyProjectile::QueueImpactCue(const FHitResult& Hit)
+{
+	if (!ImpactCueTag.IsValid())
 	{
 		return;
 	}
 
-	SpecHandle.Data->SetSetByCallerMagnitude(DamageDataTag, -DamageValue);
-	SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+	if (UAG_ImpactCueSubsystem* CueSubsystem = GetWorld()->GetSubsystem<UAG_ImpactCueSubsystem>())
+	{
+		CueSubsystem->QueueImpactCue(ImpactCueTag, Hit, GetInstigator());
+	}
 }
 
 bool AEnemyProjectile::ShouldIgnoreTargetActor(const AActor* TargetActor) const
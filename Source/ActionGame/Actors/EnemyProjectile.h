@@ -48,6 +48,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile")
 	bool bDestroyOnHit = true;
 
+	/** б֣ UAG_ImpactCueSubsystem ·Ϊ򲻲 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile")
+	FGameplayTag ImpactCueTag;
+
 protected:
 	UFUNCTION()
 	void OnProjectileHit(
@@ -81,5 +85,6 @@ private:
 
 private:
 	void ApplyDamageIfPossible(const FHitResult& Hit);
+	void QueueImpactCue(const FHitResult& Hit);
 	bool ShouldIgnoreTargetActor(const AActor* TargetActor) const;
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "EnemySpawnManager.h"
 
+#include "ActionGameGameState.h"
 #include "Characters/EnemyCharacterBase.h"
+#include "DataAssets/DifficultyCurveDataAsset.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -93,12 +95,13 @@ void AEnemySpawnManager::StartSpawnTimer()
 		return;
 	}
 
-	// öʱѭ HandleSpawnTimerElapsed
+	// öʱѭ HandleSpawnTimerElapsedѶȽ׶εˢֱţ
+	ActiveSpawnInterval = GetScaledSpawnInterval();
 	World->GetTimerManager().SetTimer(
 		SpawnTimerHandle,
 		this,
 		&AEnemySpawnManager::HandleSpawnTimerElapsed,
-		SpawnInterval,
+		ActiveSpawnInterval,
 		true
 	);
 }
@@ -133,9 +136,26 @@ void AEnemySpawnManager::HandleSpawnTimerElapsed()
 	if (!bSpawnInfinitely && SpawnedEnemyCount >= TotalEnemyToSpawn)
 	{
 		StopSpawnTimer();
+		return;
+	}
+
+	// ѶȽ׶α仯ˢƵʸű䣬öʱ
+	if (!FMath::IsNearlyEqual(ActiveSpawnInterval, GetScaledSpawnInterval()))
+	{
+		StopSpawnTimer();
+		StartSpawnTimer();
 	}
 }
 
+// Ѷȱ SpawnRate Խ󣬼Խ
+float AEnemySpawnManager::GetScaledSpawnInterval() const
+{
+	const AActionGameGameState* GS = GetWorld() ? GetWorld()->GetGameState<AActionGameGameState>() : nullptr;
+	const float SpawnRate = GS ? GS->GetCurrentStageScales().SpawnRate : 1.f;
+
+	return SpawnInterval / FMath::Max(KINDA_SMALL_NUMBER, SpawnRate);
+}
+
 // ǷˢɿءĿЧɰ뾶ñǿաδ
 bool AEnemySpawnManager::CanSpawn() const
 {
@@ -49,6 +49,9 @@ private:
 	void HandleSpawnTimerElapsed();
 	bool CanSpawn() const;
 
+	/** SpawnInterval ǰѶȽ׶ε SpawnRate  */
+	float GetScaledSpawnInterval() const;
+
 	/** ֻλã˵Ķ߶ƫ */
 	bool FindSpawnLocation(FVector& OutSpawnLocation) const;
 
@@ -96,4 +99,7 @@ private:
 	TWeakObjectPtr<AActor> FocusActor;
 
 	FTimerHandle SpawnTimerHandle;
+
+	/** ǰʱʹõļ */
+	float ActiveSpawnInterval = 0.f;
 };
\ No newline at end of file
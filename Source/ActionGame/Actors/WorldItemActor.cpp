@@ -8,6 +8,7 @@
 #include "Components/BoxComponent.h"
 #include "Components/SceneComponent.h"
 
+#include "ActionGameCollisionChannels.h"
 #include "DataAssets/DA_Item.h"
 #include "ActorComponents/ItemContainerComponent.h"
 #include "AbilitySystem/Components/InteractableComponent.h"
@@ -35,7 +36,7 @@ AWorldItemActor::AWorldItemActor()
 	InteractTargetBox = CreateDefaultSubobject<UBoxComponent>(TEXT("InteractTargetBox"));
 	InteractTargetBox->SetupAttachment(RootComponent);
 	InteractTargetBox->SetCollisionResponseToAllChannels(ECR_Ignore);
-	InteractTargetBox->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block);
+	InteractTargetBox->SetCollisionResponseToChannel(FAGCollisionChannels::InteractPickup(), ECR_Block);
 	InteractTargetBox->ComponentTags.Add(InteractTags::InteractTarget);
 	InteractTargetBox->SetBoxExtent(InteractBoxExtent);
 
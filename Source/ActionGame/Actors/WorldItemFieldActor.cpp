@@ -0,0 +1,183 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Actors/WorldItemFieldActor.h"
+
+#include "ActionGame.h"
+#include "Actors/WorldItemActor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "DataAssets/DA_Item.h"
+#include "Engine/StaticMesh.h"
+#include "Net/UnrealNetwork.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("World Item Field Instances"), STAT_AG_WorldItemFieldInstances, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("World Item Field Meshes"), STAT_AG_WorldItemFieldMeshes, STATGROUP_ActionGame);
+
+void FWorldItemFieldEntry::PostReplicatedAdd(const FWorldItemFieldArray& InArray)
+{
+	if (InArray.Owner)
+	{
+		InArray.Owner->AddVisual(*this);
+	}
+}
+
+void FWorldItemFieldEntry::PreReplicatedRemove(const FWorldItemFieldArray& InArray)
+{
+	if (InArray.Owner)
+	{
+		InArray.Owner->RemoveVisual(*this);
+	}
+}
+
+AWorldItemFieldActor::AWorldItemFieldActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = true;
+
+	// ֻĿ仯ʱŻͬ
+	NetDormancy = DORM_DormantAll;
+
+	SceneRootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
+	SetRootComponent(SceneRootComponent);
+
+	// ͻյװǰҪصĿ
+	ItemList.Owner = this;
+}
+
+int32 AWorldItemFieldActor::AddItem(UDA_Item* ItemDef, const FVector& Location, TSubclassOf<AWorldItemActor> ActorClass, AActor* SpawnOwner)
+{
+	if (!HasAuthority() || !ItemDef)
+	{
+		return INDEX_NONE;
+	}
+
+	FWorldItemFieldEntry& Entry = ItemList.Items.AddDefaulted_GetRef();
+	Entry.ItemDef = ItemDef;
+	Entry.Location = Location;
+	Entry.ActorClass = ActorClass;
+	Entry.SpawnOwner = SpawnOwner;
+
+	FlushNetDormancy();
+	ItemList.MarkItemDirty(Entry);
+
+	//  FastArray صͬҪ
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		AddVisual(Entry);
+	}
+
+	return Entry.ReplicationID;
+}
+
+bool AWorldItemFieldActor::RemoveItem(int32 EntryId, FWorldItemFieldEntry& OutEntry)
+{
+	if (!HasAuthority())
+	{
+		return false;
+	}
+
+	const int32 Index = ItemList.Items.IndexOfByPredicate([EntryId](const FWorldItemFieldEntry& Entry)
+	{
+		return Entry.ReplicationID == EntryId;
+	});
+
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutEntry = ItemList.Items[Index];
+
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		RemoveVisual(OutEntry);
+	}
+
+	FlushNetDormancy();
+	ItemList.Items.RemoveAtSwap(Index);
+	ItemList.MarkArrayDirty();
+
+	return true;
+}
+
+AWorldItemFieldActor::FVisualBucket* AWorldItemFieldActor::FindOrAddBucket(const UDA_Item* ItemDef)
+{
+	if (!ItemDef || !ItemDef->WorldMesh)
+	{
+		return nullptr;
+	}
+
+	const TPair<const UStaticMesh*, const UMaterialInterface*> Key(ItemDef->WorldMesh.Get(), ItemDef->OverrideMaterial.Get());
+	if (FVisualBucket* Bucket = Buckets.Find(Key))
+	{
+		return Bucket;
+	}
+
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(this);
+	ISM->SetupAttachment(RootComponent);
+	ISM->SetStaticMesh(ItemDef->WorldMesh);
+	ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ISM->SetCanEverAffectNavigation(false);
+
+	if (ItemDef->OverrideMaterial)
+	{
+		ISM->SetMaterial(0, ItemDef->OverrideMaterial);
+	}
+
+	ISM->RegisterComponent();
+	InstanceComponents.Add(ISM);
+
+	SET_DWORD_STAT(STAT_AG_WorldItemFieldMeshes, InstanceComponents.Num());
+
+	FVisualBucket& Bucket = Buckets.Add(Key);
+	Bucket.Component = ISM;
+	return &Bucket;
+}
+
+void AWorldItemFieldActor::AddVisual(const FWorldItemFieldEntry& Entry)
+{
+	FVisualBucket* Bucket = FindOrAddBucket(Entry.ItemDef);
+	if (!Bucket)
+	{
+		return;
+	}
+
+	// ͬһ Mesh ֱͬȡΧ
+	const float MeshDiameter = Entry.ItemDef->WorldMesh->GetBounds().BoxExtent.GetMax() * 2.f;
+	const float Scale = (MeshDiameter > KINDA_SMALL_NUMBER) ? TargetWorldSize / MeshDiameter : 1.f;
+
+	Bucket->Component->AddInstance(FTransform(FQuat::Identity, Entry.Location, FVector(Scale)), true);
+	Bucket->EntryIds.Add(Entry.ReplicationID);
+
+	INC_DWORD_STAT(STAT_AG_WorldItemFieldInstances);
+}
+
+void AWorldItemFieldActor::RemoveVisual(const FWorldItemFieldEntry& Entry)
+{
+	FVisualBucket* Bucket = FindOrAddBucket(Entry.ItemDef);
+	if (!Bucket)
+	{
+		return;
+	}
+
+	const int32 InstanceIndex = Bucket->EntryIds.IndexOfByKey(Entry.ReplicationID);
+	if (InstanceIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// ISM ɾʵֺ±˳EntryIds ͬɾ
+	Bucket->Component->RemoveInstance(InstanceIndex);
+	Bucket->EntryIds.RemoveAt(InstanceIndex);
+
+	DEC_DWORD_STAT(STAT_AG_WorldItemFieldInstances);
+}
+
+void AWorldItemFieldActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AWorldItemFieldActor, ItemList);
+}
@@ -0,0 +1,127 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "WorldItemFieldActor.generated.h"
+
+class UDA_Item;
+class AWorldItemActor;
+class AWorldItemFieldActor;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+class UMaterialInterface;
+struct FWorldItemFieldArray;
+
+/** һõĵ */
+USTRUCT()
+struct FWorldItemFieldEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UDA_Item> ItemDef = nullptr;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location = FVector::ZeroVector;
+
+	/** Ϊ Actor ʱʹõ࣬ */
+	UPROPERTY(NotReplicated)
+	TSubclassOf<AWorldItemActor> ActorClass;
+
+	/** Ϊ Actor ʱ OwnerԴ */
+	UPROPERTY(NotReplicated)
+	TWeakObjectPtr<AActor> SpawnOwner;
+
+	void PostReplicatedAdd(const FWorldItemFieldArray& InArray);
+	void PreReplicatedRemove(const FWorldItemFieldArray& InArray);
+};
+
+USTRUCT()
+struct FWorldItemFieldArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FWorldItemFieldEntry> Items;
+
+	UPROPERTY(NotReplicated)
+	TObjectPtr<AWorldItemFieldActor> Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FWorldItemFieldEntry, FWorldItemFieldArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FWorldItemFieldArray> : public TStructOpsTypeTraitsBase2<FWorldItemFieldArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * AWorldItemFieldActor
+ *
+ * оõļϣ UAG_WorldItemFieldSubsystem ڷɣȫΨһ
+ *
+ * - ÿƷֻ FastArray еһ¼ɾֻͬ仯Ŀûб仯ʱ Actor 
+ * - ֣ͬһ Mesh + ʹһ InstancedStaticMeshComponentŰ Mesh ֻһ
+ * - 𽻻ҿʱϵͳĿΪ AWorldItemActor
+ */
+UCLASS(NotBlueprintable)
+class ACTIONGAME_API AWorldItemFieldActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AWorldItemFieldActor();
+
+	/** һƷĿ Idʧܷ INDEX_NONE */
+	int32 AddItem(UDA_Item* ItemDef, const FVector& Location, TSubclassOf<AWorldItemActor> ActorClass, AActor* SpawnOwner = nullptr);
+
+	/** ƳĿOutEntry رƳ */
+	bool RemoveItem(int32 EntryId, FWorldItemFieldEntry& OutEntry);
+
+	int32 GetNumItems() const { return ItemList.Items.Num(); }
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+protected:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<USceneComponent> SceneRootComponent;
+
+	UPROPERTY(Replicated)
+	FWorldItemFieldArray ItemList;
+
+	// Ӿֱ AWorldItemActor::TargetWorldSize һ£
+	UPROPERTY(EditDefaultsOnly, Category = "Display")
+	float TargetWorldSize = 50.f;
+
+private:
+	friend struct FWorldItemFieldEntry;
+
+	/** ͬһ Mesh + ʵʵ */
+	struct FVisualBucket
+	{
+		TObjectPtr<UInstancedStaticMeshComponent> Component = nullptr;
+
+		/** ʵ±һһӦĿ Id */
+		TArray<int32> EntryIds;
+	};
+
+	void AddVisual(const FWorldItemFieldEntry& Entry);
+	void RemoveVisual(const FWorldItemFieldEntry& Entry);
+
+	FVisualBucket* FindOrAddBucket(const UDA_Item* ItemDef);
+
+	TMap<TPair<const UStaticMesh*, const UMaterialInterface*>, FVisualBucket> Buckets;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> InstanceComponents;
+};
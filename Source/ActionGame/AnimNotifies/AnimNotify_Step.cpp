@@ -3,6 +3,7 @@
 
 #include "AnimNotifies/AnimNotify_Step.h"
 
+#include "ActionGameplayTags.h"
 #include "ActionGameCharacter.h"
 #include "ActorComponents/FootstepsComponent.h"
 
@@ -16,10 +17,7 @@ void UAnimNotify_Step::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBas
 
 	if (UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent())
 	{
-		static const FGameplayTag DeadTag = FGameplayTag::RequestGameplayTag(TEXT("State.Dead"));
-		static const FGameplayTag RagdollTag = FGameplayTag::RequestGameplayTag(TEXT("State.Ragdoll"));
-
-		if (ASC->HasMatchingGameplayTag(DeadTag) || ASC->HasMatchingGameplayTag(RagdollTag))
+		if (ASC->HasMatchingGameplayTag(AGGameplayTags::State_Dead) || ASC->HasMatchingGameplayTag(AGGameplayTags::State_Ragdoll))
 		{
 			return;
 		}
@@ -2,9 +2,12 @@
 
 #include "Characters/EnemyCharacterBase.h"
 
+#include "ActionGameplayTags.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
 
+#include "AIController.h"
+#include "BrainComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
@@ -16,25 +19,56 @@
 #include "DataAssets/EnemyConfigDataAsset.h"
 #include <BehaviorTree/Decorators/BTDecorator_ConditionalLoop.h>
 #include "GameplayEffect.h"
+#include "GameplayEffectComponent.h"
+#include "Algo/AnyOf.h"
 #include "ActionGameGameState.h"
-
-AEnemyCharacterBase::AEnemyCharacterBase()
+#include "DataAssets/DifficultyCurveDataAsset.h"
+#include "Subsystems/AG_DeathQueueSubsystem.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+#include "ActorComponents/AG_EnemyCombatComponent.h"
+#include "ActionGame.h"
+#include "ActionGameCollisionChannels.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Init (ASC)"), STAT_AG_EnemyInitFull, STATGROUP_ActionGame);
+DECLARE_CYCLE_STAT(TEXT("Enemy Init (Lite)"), STAT_AG_EnemyInitLite, STATGROUP_ActionGame);
+DECLARE_CYCLE_STAT(TEXT("Enemy Init (Direct)"), STAT_AG_EnemyInitDirect, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarEnemyDirectInit(
+	TEXT("ag.Enemy.DirectInit"),
+	1,
+	TEXT("Write enemy init attributes straight to base values instead of applying the init GE (0 = always use the GE)"),
+	ECVF_Default
+);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Lite Enemies Spawned"), STAT_AG_LiteEnemiesSpawned, STATGROUP_ActionGame);
+
+FName AEnemyCharacterBase::AbilitySystemComponentName(TEXT("AbilitySystemComponent"));
+FName AEnemyCharacterBase::EnemyAttributeSetName(TEXT("EnemyAttributeSet"));
+
+AEnemyCharacterBase::AEnemyCharacterBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
 
-	// GAS
-	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+	// GASͨ DoNotCreateDefaultSubobject ص
+	AbilitySystemComponent = CreateOptionalDefaultSubobject<UAG_AbilitySystemComponentBase>(AbilitySystemComponentName);
 	if (AbilitySystemComponent)
 	{
 		AbilitySystemComponent->SetIsReplicated(true);
 		AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
+
+		EnemyAttributeSet = CreateOptionalDefaultSubobject<UAG_EnemyAttributeSet>(EnemyAttributeSetName);
+	}
+	else
+	{
+		// û ASCս
+		CombatComponent = CreateDefaultSubobject<UAG_EnemyCombatComponent>(TEXT("CombatComponent"));
 	}
 
-	EnemyAttributeSet = CreateDefaultSubobject<UAG_EnemyAttributeSet>(TEXT("EnemyAttributeSet"));
+	DamageDataTag = AGGameplayTags::Data_Damage;
 
 	// 
-	DeadTag = FGameplayTag::RequestGameplayTag(TEXT("State.Dead"));
+	DeadTag = AGGameplayTags::State_Dead;
 	if (AbilitySystemComponent && EnemyAttributeSet)
 	{
 		AbilitySystemComponent
@@ -42,7 +76,7 @@ AEnemyCharacterBase::AEnemyCharacterBase()
 			.AddUObject(this, &AEnemyCharacterBase::OnHealthAttributeChanged);
 
 		AbilitySystemComponent->RegisterGameplayTagEvent(
-			FGameplayTag::RequestGameplayTag(TEXT("State.Ragdoll")),
+			AGGameplayTags::State_Ragdoll,
 			EGameplayTagEventType::NewOrRemoved
 		).AddUObject(this, &AEnemyCharacterBase::OnRagdollStateTagChanged);
 	}
@@ -54,7 +88,7 @@ void AEnemyCharacterBase::BeginPlay()
 
 	if (!DeadTag.IsValid())
 	{
-		DeadTag = FGameplayTag::RequestGameplayTag(TEXT("State.Dead"));
+		DeadTag = AGGameplayTags::State_Dead;
 	}
 
 	if (AbilitySystemComponent)
@@ -62,6 +96,12 @@ void AEnemyCharacterBase::BeginPlay()
 		AbilitySystemComponent->InitAbilityActorInfo(this, this);
 	}
 
+	if (CombatComponent)
+	{
+		// ع㲥 + ͻ OnRep 
+		CombatComponent->OnStateChanged.AddUObject(this, &AEnemyCharacterBase::OnCombatStateChanged);
+	}
+
 	// Init 
 	InitializeEnemy();
 
@@ -77,6 +117,33 @@ UAbilitySystemComponent* AEnemyCharacterBase::GetAbilitySystemComponent() const
 	return AbilitySystemComponent;
 }
 
+bool AEnemyCharacterBase::IsDead() const
+{
+	if (CombatComponent)
+	{
+		return CombatComponent->IsDead();
+	}
+
+	return AbilitySystemComponent && DeadTag.IsValid() && AbilitySystemComponent->HasMatchingGameplayTag(DeadTag);
+}
+
+float AEnemyCharacterBase::GetAttackDamage() const
+{
+	if (CombatComponent)
+	{
+		return CombatComponent->GetAttackPower() * CombatComponent->GetAttackMultiplier();
+	}
+
+	if (!AbilitySystemComponent)
+	{
+		return 0.f;
+	}
+
+	const float AttackPower = AbilitySystemComponent->GetNumericAttribute(UAG_EnemyAttributeSet::GetAttackPowerAttribute());
+	const float AttackMul = AbilitySystemComponent->GetNumericAttribute(UAG_EnemyAttributeSet::GetAttackMultiplierAttribute());
+	return AttackPower * AttackMul;
+}
+
 int32 AEnemyCharacterBase::GetCurrentDifficultyStage() const
 {
 	if (const AActionGameGameState* GS = GetWorld()->GetGameState<AActionGameGameState>())
@@ -86,11 +153,32 @@ int32 AEnemyCharacterBase::GetCurrentDifficultyStage() const
 	return 0;
 }
 
+FDifficultyStageScales AEnemyCharacterBase::GetDifficultyScales(int32 Stage) const
+{
+	if (const AActionGameGameState* GS = GetWorld()->GetGameState<AActionGameGameState>())
+	{
+		return GS->GetStageScales(Stage);
+	}
+	return GetDefault<UDifficultyCurveDataAsset>()->GetStageScales(Stage);
+}
+
 void AEnemyCharacterBase::PerformAttack(AActor* TargetActor)
 {
 	// Base default: do nothing.
 }
 
+float AEnemyCharacterBase::GetBountyGold() const
+{
+	if (CombatComponent)
+	{
+		return CombatComponent->GetBountyGold();
+	}
+
+	return AbilitySystemComponent
+		? AbilitySystemComponent->GetNumericAttribute(UAG_EnemyAttributeSet::GetBountyGoldAttribute())
+		: 0.f;
+}
+
 void AEnemyCharacterBase::InitFromSpawnEntry(const FEnemySpawnEntry& InEntry)
 {
 	EnemyConfig = InEntry.EnemyConfig;
@@ -164,6 +252,9 @@ void AEnemyCharacterBase::GiveDeathAbility()
 	if (!HasAuthority()) return;
 	if (!AbilitySystemComponent || !DeathAbilityClass) return;
 
+	//  UAG_DeathQueueSubsystem ͳһ㣬Ҫÿһ GA
+	if (DeathEffectClass) return;
+
 	AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(DeathAbilityClass, 1));
 }
 
@@ -284,7 +375,7 @@ void AEnemyCharacterBase::ApplyInitAttributes()
 		return;
 	}
 
-	if (!AbilitySystemComponent)
+	if (!AbilitySystemComponent && !CombatComponent)
 	{
 		UE_LOG(LogTemp, Warning,
 			TEXT("[%s] ApplyInitAttributes failed: AbilitySystemComponent is null"),
@@ -292,7 +383,9 @@ void AEnemyCharacterBase::ApplyInitAttributes()
 		return;
 	}
 
-	if (!EnemyInitEffectClass)
+	const bool bDirectInit = CanUseDirectAttributeInit();
+
+	if (AbilitySystemComponent && !bDirectInit && !EnemyInitEffectClass)
 	{
 		UE_LOG(LogTemp, Warning,
 			TEXT("[%s] ApplyInitAttributes failed: EnemyInitEffectClass is null"),
@@ -308,11 +401,12 @@ void AEnemyCharacterBase::ApplyInitAttributes()
 		return;
 	}
 
-	// ȡǰѶȽ׶
+	// ȡǰѶȽ׶ΣʴԤѶȱȡ
 	const int32 Stage = GetCurrentDifficultyStage();
-	const float HealthScale = FMath::Pow(1.18f, Stage);
-	const float AttackScale = FMath::Pow(1.12f, Stage);
-	const float GoldScale = FMath::Pow(1.10f, Stage);
+	const FDifficultyStageScales Scales = GetDifficultyScales(Stage);
+	const float HealthScale = Scales.Health;
+	const float AttackScale = Scales.Attack;
+	const float GoldScale = Scales.Gold;
 
 	const FEnemyConfigData& D = EnemyConfig->EnemyConfigData;
 
@@ -331,16 +425,38 @@ void AEnemyCharacterBase::ApplyInitAttributes()
 	const float InitAttackMul = BaseAttackMul;
 	const float InitBountyGold = GoldScale * BaseBountyGold;
 
-	static const FGameplayTag Tag_InitHealth =
-		FGameplayTag::RequestGameplayTag(TEXT("Data.Init.Health"));
-	static const FGameplayTag Tag_InitMaxHealth =
-		FGameplayTag::RequestGameplayTag(TEXT("Data.Init.MaxHealth"));
-	static const FGameplayTag Tag_InitAttackPower =
-		FGameplayTag::RequestGameplayTag(TEXT("Data.Init.AttackPower"));
-	static const FGameplayTag Tag_InitAttackMul =
-		FGameplayTag::RequestGameplayTag(TEXT("Data.Init.AttackMultiplier"));
-	static const FGameplayTag Tag_InitBountyGold =
-		FGameplayTag::RequestGameplayTag(TEXT("Data.Init.BountyGold"));
+	// ˣֱд Init GE
+	if (CombatComponent)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AG_EnemyInitLite);
+		INC_DWORD_STAT(STAT_AG_LiteEnemiesSpawned);
+
+		CombatComponent->InitAttributes(InitHealth, InitMaxHealth, InitAttackPower, InitAttackMul, InitBountyGold);
+		bInitAttributesApplied = true;
+		return;
+	}
+
+	// ·ֱд AttributeSet  BaseValue Spec / ۺ
+	if (bDirectInit)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AG_EnemyInitDirect);
+
+		// д MaxHealthHealth ǯ
+		AbilitySystemComponent->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetMaxHealthAttribute(), InitMaxHealth);
+		AbilitySystemComponent->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetHealthAttribute(), InitHealth);
+		AbilitySystemComponent->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetAttackPowerAttribute(), InitAttackPower);
+		AbilitySystemComponent->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetAttackMultiplierAttribute(), InitAttackMul);
+		AbilitySystemComponent->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetBountyGoldAttribute(), InitBountyGold);
+
+		bInitAttributesApplied = true;
+
+		UE_LOG(LogTemp, Verbose,
+			TEXT("[%s] InitAttributes (direct) | Stage=%d | HP=%.1f/%.1f AP=%.1f Mul=%.2f Gold=%.1f"),
+			*GetName(), Stage, InitHealth, InitMaxHealth, InitAttackPower, InitAttackMul, InitBountyGold);
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AG_EnemyInitFull);
 
 	FGameplayEffectContextHandle Ctx = AbilitySystemComponent->MakeEffectContext();
 	Ctx.AddSourceObject(this);
@@ -363,11 +479,11 @@ void AEnemyCharacterBase::ApplyInitAttributes()
 		return;
 	}
 
-	EffectSpec->SetSetByCallerMagnitude(Tag_InitHealth, InitHealth);
-	EffectSpec->SetSetByCallerMagnitude(Tag_InitMaxHealth, InitMaxHealth);
-	EffectSpec->SetSetByCallerMagnitude(Tag_InitAttackPower, InitAttackPower);
-	EffectSpec->SetSetByCallerMagnitude(Tag_InitAttackMul, InitAttackMul);
-	EffectSpec->SetSetByCallerMagnitude(Tag_InitBountyGold, InitBountyGold);
+	EffectSpec->SetSetByCallerMagnitude(AGGameplayTags::Data_Init_Health, InitHealth);
+	EffectSpec->SetSetByCallerMagnitude(AGGameplayTags::Data_Init_MaxHealth, InitMaxHealth);
+	EffectSpec->SetSetByCallerMagnitude(AGGameplayTags::Data_Init_AttackPower, InitAttackPower);
+	EffectSpec->SetSetByCallerMagnitude(AGGameplayTags::Data_Init_AttackMultiplier, InitAttackMul);
+	EffectSpec->SetSetByCallerMagnitude(AGGameplayTags::Data_Init_BountyGold, InitBountyGold);
 
 	AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*EffectSpec);
 
@@ -395,6 +511,69 @@ void AEnemyCharacterBase::ApplyInitAttributes()
 		InitBountyGold);
 }
 
+bool AEnemyCharacterBase::CanUseDirectAttributeInit() const
+{
+	if (CVarEnemyDirectInit.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+
+	if (!AbilitySystemComponent || !EnemyAttributeSet
+		|| !AbilitySystemComponent->HasAttributeSetForAttribute(UAG_EnemyAttributeSet::GetHealthAttribute()))
+	{
+		return false;
+	}
+
+	const UGameplayEffect* InitEffectCDO = EnemyInitEffectClass ? EnemyInitEffectClass.GetDefaultObject() : nullptr;
+	return !InitEffectCDO || IsDirectInitEquivalent(InitEffectCDO);
+}
+
+bool AEnemyCharacterBase::IsDirectInitEquivalent(const UGameplayEffect* InitEffectCDO)
+{
+	//  Init GE ҪּExecution / Cue / TagЧȣֱдֵʱᶪ
+	if (InitEffectCDO->DurationPolicy != EGameplayEffectDurationType::Instant
+		|| InitEffectCDO->Executions.Num() > 0
+		|| InitEffectCDO->GameplayCues.Num() > 0
+		|| InitEffectCDO->FindComponent(UGameplayEffectComponent::StaticClass()))
+	{
+		return false;
+	}
+
+	// ֻöӦ Data.Init.* 
+	const TPair<FGameplayAttribute, FGameplayTag> InitModifiers[] =
+	{
+		{ UAG_EnemyAttributeSet::GetHealthAttribute(), AGGameplayTags::Data_Init_Health },
+		{ UAG_EnemyAttributeSet::GetMaxHealthAttribute(), AGGameplayTags::Data_Init_MaxHealth },
+		{ UAG_EnemyAttributeSet::GetAttackPowerAttribute(), AGGameplayTags::Data_Init_AttackPower },
+		{ UAG_EnemyAttributeSet::GetAttackMultiplierAttribute(), AGGameplayTags::Data_Init_AttackMultiplier },
+		{ UAG_EnemyAttributeSet::GetBountyGoldAttribute(), AGGameplayTags::Data_Init_BountyGold },
+	};
+
+	for (const FGameplayModifierInfo& Modifier : InitEffectCDO->Modifiers)
+	{
+		if (Modifier.ModifierOp != EGameplayModOp::Override
+			|| Modifier.ModifierMagnitude.GetMagnitudeCalculationType() != EGameplayEffectMagnitudeCalculation::SetByCaller
+			|| !Modifier.SourceTags.IsEmpty()
+			|| !Modifier.TargetTags.IsEmpty())
+		{
+			return false;
+		}
+
+		const FGameplayTag DataTag = Modifier.ModifierMagnitude.GetSetByCallerFloat().DataTag;
+		const bool bKnown = Algo::AnyOf(InitModifiers, [&Modifier, &DataTag](const TPair<FGameplayAttribute, FGameplayTag>& Init)
+		{
+			return Init.Key == Modifier.Attribute && Init.Value == DataTag;
+		});
+
+		if (!bKnown)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 // 
 void AEnemyCharacterBase::OnHealthAttributeChanged(const FOnAttributeChangeData& Data)
 {
@@ -413,6 +592,19 @@ void AEnemyCharacterBase::OnHealthAttributeChanged(const FOnAttributeChangeData&
 
 	UE_LOG(LogTemp, Log, TEXT("%s health changed to zero or below, instigator: %s"), *GetName(), InstigatorActor ? *InstigatorActor->GetName() : TEXT("None"));
 
+	// ״̬֡ЧٱĿꡢٹ / Ա
+	if (HasAuthority())
+	{
+		EnterDeadState();
+	}
+
+	// ֺͽ߶У֡Ԥ̯һδʱͬ֡д
+	if (UAG_DeathQueueSubsystem* DeathQueue = GetWorld()->GetSubsystem<UAG_DeathQueueSubsystem>())
+	{
+		DeathQueue->QueueDeath(this, InstigatorActor, ZeroHealthEventTag);
+		return;
+	}
+
 	FGameplayEventData Payload;
 	Payload.EventTag = ZeroHealthEventTag;
 	Payload.Instigator = InstigatorActor;
@@ -429,6 +621,58 @@ void AEnemyCharacterBase::OnRagdollStateTagChanged(const FGameplayTag CallbackTa
 	}
 }
 
+// ˣ
+void AEnemyCharacterBase::OnCombatStateChanged(EEnemyCombatState NewState)
+{
+	if (EnumHasAnyFlags(NewState, EEnemyCombatState::Dead) && HasAuthority())
+	{
+		EnterDeadState();
+	}
+
+	if (EnumHasAnyFlags(NewState, EEnemyCombatState::Ragdoll))
+	{
+		StartRagdoll();
+	}
+}
+
+// 
+void AEnemyCharacterBase::EnterDeadState()
+{
+	// ˵ Dead Լά
+	if (AbilitySystemComponent && DeadTag.IsValid() && !AbilitySystemComponent->HasMatchingGameplayTag(DeadTag))
+	{
+		AbilitySystemComponent->AddLooseGameplayTag(DeadTag);
+		AbilitySystemComponent->AddReplicatedLooseGameplayTag(DeadTag);
+	}
+
+	if (AAIController* AIController = Cast<AAIController>(GetController()))
+	{
+		AIController->StopMovement();
+		if (UBrainComponent* Brain = AIController->GetBrainComponent())
+		{
+			Brain->StopLogic(TEXT("Dead"));
+		}
+	}
+
+	bCanAttack = false;
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->StopMovementImmediately();
+		MoveComp->DisableMovement();
+	}
+
+	// ʬ岻ٳӵ
+	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
+	{
+		Capsule->SetCollisionResponseToChannel(FAGCollisionChannels::WeaponTrace(), ECR_Ignore);
+	}
+	if (USkeletalMeshComponent* SkeletalMesh = GetMesh())
+	{
+		SkeletalMesh->SetCollisionResponseToChannel(FAGCollisionChannels::WeaponTrace(), ECR_Ignore);
+	}
+}
+
 // 
 void AEnemyCharacterBase::StartRagdoll()
 {
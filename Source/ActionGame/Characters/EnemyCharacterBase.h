@@ -15,6 +15,9 @@ class UAG_EnemyAttributeSet;
 class UGameplayEffect;
 class UGameplayAbility;
 class UEnemyConfigDataAsset;
+class UAG_EnemyCombatComponent;
+enum class EEnemyCombatState : uint8;
+struct FDifficultyStageScales;
 
 UCLASS(Abstract)
 class ACTIONGAME_API AEnemyCharacterBase : public ACharacter, public IAbilitySystemInterface
@@ -22,12 +25,35 @@ class ACTIONGAME_API AEnemyCharacterBase : public ACharacter, public IAbilitySys
 	GENERATED_BODY()
 
 public:
-	AEnemyCharacterBase();
+	/**
+	 * ڹ캯ر ASC/AttributeSet ս
+	 * Super(ObjectInitializer.DoNotCreateDefaultSubobject(AbilitySystemComponentName).DoNotCreateDefaultSubobject(EnemyAttributeSetName))
+	 */
+	AEnemyCharacterBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	static FName AbilitySystemComponentName;
+	static FName EnemyAttributeSetName;
 
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
 
+	/** ˲У ASC ˷ nullptr */
+	UAG_EnemyCombatComponent* GetCombatComponent() const { return CombatComponent; }
+
+	/** ͬʱ ASCState.Dead */
+	bool IsDead() const;
+
+	/** AttackPower * AttackMultiplierֵͳһȡ */
+	float GetAttackDamage() const;
+
+	float GetBountyGold() const;
+
+	TSubclassOf<UGameplayEffect> GetDeathEffectClass() const { return DeathEffectClass; }
+	TSubclassOf<UGameplayEffect> GetRewardEffectClass() const { return RewardEffectClass; }
+
 	int32 GetCurrentDifficultyStage() const;
 
+	FDifficultyStageScales GetDifficultyScales(int32 Stage) const;
+
 	/** BT Service ãѡĿ */
 	UFUNCTION(BlueprintCallable, Category = "Enemy|Target")
 	ACharacter* FindBestTarget() const;
@@ -36,6 +62,12 @@ public:
 	// Death / Ragdoll
 	void StartRagdoll();
 
+	/**
+	 * 㵱֡ЧĲ֣State.Deadͣ AIͣƶٵ
+	 *  GE /  / ͽ UAG_DeathQueueSubsystem ̯֡
+	 */
+	void EnterDeadState();
+
 	void OnHealthAttributeChanged(const FOnAttributeChangeData& Data);
 
 protected:
@@ -53,6 +85,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GAS", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UAG_EnemyAttributeSet> EnemyAttributeSet;
 
+	//  ASC ʱ
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Combat", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UAG_EnemyCombatComponent> CombatComponent;
+
+	void OnCombatStateChanged(EEnemyCombatState NewState);
+
 	UPROPERTY(EditDefaultsOnly, Category = "Abilities|Events")
 	FGameplayTag ZeroHealthEventTag;
 
@@ -61,7 +99,7 @@ protected:
 	TSubclassOf<UGameplayEffect> DamageEffectClass = nullptr;
 
 	UPROPERTY(EditDefaultsOnly, Category = "PrimaryAttack|Damage")
-	FGameplayTag DamageDataTag = FGameplayTag::RequestGameplayTag(TEXT("Data.Damage"));
+	FGameplayTag DamageDataTag;
 
 protected:
 	// Targeting helpers
@@ -72,9 +110,18 @@ protected:
 	FGameplayTag DeadTag;
 
 protected:
+	/** ̣ DeathEffectClass ʱ */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Abilities|Death")
 	TSubclassOf<UGameplayAbility> DeathAbilityClass;
 
+	/** ϵͳӦõ GEState.Dead / State.Ragdoll */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Abilities|Death")
+	TSubclassOf<UGameplayEffect> DeathEffectClass;
+
+	/** ɱߵĽ GESetByCaller Data.Reward.Gold֡ϲ */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Abilities|Death")
+	TSubclassOf<UGameplayEffect> RewardEffectClass;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Abilities|Startup")
 	TArray<TSubclassOf<UGameplayEffect>> StartupEffects;
 
@@ -139,5 +186,11 @@ private:
 	void ApplyStartupEffects();
 	void ApplyRuntimeConfig();	
 	void ApplyInitAttributes();
+
+	/** Init GE δûֱдֵȼۡ AttributeSet עʱֱд BaseValue */
+	bool CanUseDirectAttributeInit() const;
+
+	/** ˲ʱֻ Data.Init.* Ե Overrideû Execution / Cue /  */
+	static bool IsDirectInitEquivalent(const UGameplayEffect* InitEffectCDO);
 	void InitializeEnemy();
 };
\ No newline at end of file
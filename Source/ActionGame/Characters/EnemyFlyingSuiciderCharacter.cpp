@@ -4,10 +4,10 @@
 #include "AbilitySystemComponent.h"
 #include "ActionGameCharacter.h"
 #include "Components/SphereComponent.h"
-#include "Engine/OverlapResult.h"
 #include "Engine/World.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameplayEffect.h"
+#include "Subsystems/AG_AreaDamageSubsystem.h"
 
 AEnemyFlyingSuiciderCharacter::AEnemyFlyingSuiciderCharacter()
 {
@@ -72,8 +72,7 @@ void AEnemyFlyingSuiciderCharacter::OnTriggerBeginOverlap(
 	}
 
 	// ܱ
-	if (AbilitySystemComponent && DeadTag.IsValid() &&
-		AbilitySystemComponent->HasMatchingGameplayTag(DeadTag))
+	if (IsDead())
 	{
 		return;
 	}
@@ -107,74 +106,32 @@ void AEnemyFlyingSuiciderCharacter::ExplodeAndApply_Server()
 
 	bExploded = true;
 
-	const FVector Origin = GetActorLocation();
-
-	if (ExplosionEffect)
+	UWorld* World = GetWorld();
+	UAG_AreaDamageSubsystem* AreaDamage = World ? World->GetSubsystem<UAG_AreaDamageSubsystem>() : nullptr;
+	if (!AreaDamage)
 	{
-		UWorld* World = GetWorld();
-		if (World)
-		{
-			FCollisionObjectQueryParams ObjParams;
-			ObjParams.AddObjectTypesToQuery(ECC_Pawn);
-
-			const FCollisionShape Sphere = FCollisionShape::MakeSphere(ExplosionRadius);
-
-			TArray<FOverlapResult> Hits;
-			World->OverlapMultiByObjectType(
-				Hits,
-				Origin,
-				FQuat::Identity,
-				ObjParams,
-				Sphere
-			);
-
-			UAbilitySystemComponent* SourceASC = GetAbilitySystemComponent();
-
-			for (const FOverlapResult& Result : Hits)
-			{
-				ACharacter* Character = Cast<ACharacter>(Result.GetActor());
-				if (!IsValid(Character) || Character == this)
-				{
-					continue;
-				}
-
-				if (AffectedActors.Contains(Character))
-				{
-					continue;
-				}
-				AffectedActors.Add(Character);
-
-				UAbilitySystemComponent* TargetASC =
-					UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Character);
-				if (!TargetASC)
-				{
-					continue;
-				}
-
-				// ĿʩЧ
-				if (DeadTag.IsValid() && TargetASC->HasMatchingGameplayTag(DeadTag))
-				{
-					continue;
-				}
-
-				if (SourceASC)
-				{
-					FGameplayEffectContextHandle Context = SourceASC->MakeEffectContext();
-					Context.AddInstigator(this, this);
-					Context.AddSourceObject(this);
-					Context.AddOrigin(Origin);
-
-					FGameplayEffectSpecHandle Spec =
-						SourceASC->MakeOutgoingSpec(ExplosionEffect, 1.f, Context);
-
-					if (Spec.IsValid())
-					{
-						SourceASC->ApplyGameplayEffectSpecToTarget(*Spec.Data.Get(), TargetASC);
-					}
-				}
-			}
-		}
+		Destroy();
+		return;
 	}
 
-	Destroy();
-}
\ No newline at end of file
+	// ˺֡ĩͬ֡ըһ㣬ɺɷ
+	FAreaDamageRequest Request;
+	Request.Instigator = this;
+	Request.SourceASC = GetAbilitySystemComponent();
+	Request.EffectClass = ExplosionEffect;
+	Request.LiteSourceDamage = -GetAttackDamage();
+	Request.Origin = GetActorLocation();
+	Request.Radius = ExplosionRadius;
+	Request.IgnoreTargetTag = DeadTag;
+	Request.bDestroyInstigator = true;
+
+	AreaDamage->QueueAreaDamage(Request);
+
+	// ֡˳ֺײ
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->DisableMovement();
+	}
+}
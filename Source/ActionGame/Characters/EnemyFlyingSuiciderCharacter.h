@@ -47,9 +47,6 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|Explode")
 	TSubclassOf<UGameplayEffect> ExplosionEffect;
 
-	UPROPERTY(Transient)
-	TSet<TWeakObjectPtr<ACharacter>> AffectedActors;
-
 protected:
 	UFUNCTION()
 	void OnTriggerBeginOverlap(
@@ -5,10 +5,10 @@
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
-#include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
-AEnemyGroundShooterCharacter::AEnemyGroundShooterCharacter()
+AEnemyGroundShooterCharacter::AEnemyGroundShooterCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = false;
 	bUseControllerRotationYaw = false;
@@ -67,9 +67,9 @@ void AEnemyGroundShooterCharacter::PerformAttack(AActor* TargetActor)
 		return;
 	}
 
-	// 1) ASC / DamageУ
+	// 1) ASC / DamageУ飨û ASCSourceASC Ϊգ
 	UAbilitySystemComponent* SourceASC = GetAbilitySystemComponent();
-	if (!SourceASC)
+	if (!SourceASC && !GetCombatComponent())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[%s] PerformAttack failed: SourceASC is null"), *GetName());
 		return;
@@ -97,25 +97,14 @@ void AEnemyGroundShooterCharacter::PerformAttack(AActor* TargetActor)
 		return;
 	}
 
-	// 3)  AttributeSet ȡԲ˺
-	const UAG_EnemyAttributeSet* EnemyAS = SourceASC->GetSet<UAG_EnemyAttributeSet>();
-	if (!EnemyAS)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] PerformAttack failed: UAG_EnemyAttributeSet is null"), *GetName());
-		return;
-	}
-
-	const float AttackPower = EnemyAS->GetAttackPower();
-	const float AttackMultiplier = EnemyAS->GetAttackMultiplier();
-	const float FinalDamage = FMath::Max(0.f, AttackPower * AttackMultiplier);
+	// 3) ȡԲ˺AttributeSet 
+	const float FinalDamage = FMath::Max(0.f, GetAttackDamage());
 
 	if (FinalDamage <= 0.f)
 	{
 		UE_LOG(LogTemp, Warning,
-			TEXT("[%s] PerformAttack warning: FinalDamage <= 0 (AP=%.2f Mul=%.2f)"),
-			*GetName(),
-			AttackPower,
-			AttackMultiplier);
+			TEXT("[%s] PerformAttack warning: FinalDamage <= 0"),
+			*GetName());
 	}
 
 	// 4) Spawn projectileȨ
@@ -151,11 +140,9 @@ void AEnemyGroundShooterCharacter::PerformAttack(AActor* TargetActor)
 	);
 
 	UE_LOG(LogTemp, Log,
-		TEXT("[%s] Fire projectile -> Target=%s | AP=%.2f Mul=%.2f FinalDamage=%.2f | Muzzle=%s Dir=%s Speed=%.1f"),
+		TEXT("[%s] Fire projectile -> Target=%s | FinalDamage=%.2f | Muzzle=%s Dir=%s Speed=%.1f"),
 		*GetName(),
 		*GetNameSafe(TargetActor),
-		AttackPower,
-		AttackMultiplier,
 		FinalDamage,
 		*MuzzleLoc.ToCompactString(),
 		*ShotDir.ToCompactString(),
@@ -13,7 +13,7 @@ class ACTIONGAME_API AEnemyGroundShooterCharacter : public AEnemyCharacterBase
 	GENERATED_BODY()
 
 public:
-	AEnemyGroundShooterCharacter();
+	AEnemyGroundShooterCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void PerformAttack(AActor* TargetActor) override;
 
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "DataAssets/DifficultyCurveDataAsset.h"
+
+#include "ActionGame.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Difficulty Table Misses"), STAT_AG_DifficultyTableMisses, STATGROUP_ActionGame);
+
+FDifficultyStageScales UDifficultyCurveDataAsset::GetStageScales(int32 Stage) const
+{
+	Stage = FMath::Max(0, Stage);
+
+#if WITH_EDITOR
+	// ⲿԴ༭ʱؽ༭ֱֵ
+	if (bUsesExternalCurves)
+	{
+		return EvaluateStage(Stage);
+	}
+#endif
+
+	if (StageTable.IsValidIndex(Stage))
+	{
+		return StageTable[Stage];
+	}
+
+	INC_DWORD_STAT(STAT_AG_DifficultyTableMisses);
+
+	return EvaluateStage(Stage);
+}
+
+void UDifficultyCurveDataAsset::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// CDO ҲGameState ûԴʱĬ϶󶵵
+	RebuildStageTable();
+}
+
+void UDifficultyCurveDataAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildStageTable();
+}
+
+#if WITH_EDITOR
+void UDifficultyCurveDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildStageTable();
+}
+#endif
+
+void UDifficultyCurveDataAsset::RebuildStageTable()
+{
+	const int32 NumStages = FMath::Max(0, MaxPrecomputedStage) + 1;
+
+#if WITH_EDITOR
+	bUsesExternalCurves = HealthCurve.ExternalCurve || AttackCurve.ExternalCurve || GoldCurve.ExternalCurve || SpawnRateCurve.ExternalCurve;
+#endif
+
+	StageTable.SetNumUninitialized(NumStages);
+	for (int32 Stage = 0; Stage < NumStages; ++Stage)
+	{
+		StageTable[Stage] = EvaluateStage(Stage);
+	}
+}
+
+FDifficultyStageScales UDifficultyCurveDataAsset::EvaluateStage(int32 Stage) const
+{
+	FDifficultyStageScales Scales;
+	Scales.Health = EvaluateCurve(HealthCurve, HealthFallbackBase, Stage);
+	Scales.Attack = EvaluateCurve(AttackCurve, AttackFallbackBase, Stage);
+	Scales.Gold = EvaluateCurve(GoldCurve, GoldFallbackBase, Stage);
+	Scales.SpawnRate = FMath::Max(KINDA_SMALL_NUMBER, EvaluateCurve(SpawnRateCurve, SpawnRateFallbackBase, Stage));
+	return Scales;
+}
+
+float UDifficultyCurveDataAsset::EvaluateCurve(const FRuntimeFloatCurve& Curve, float FallbackBase, int32 Stage)
+{
+	const FRichCurve* RichCurve = Curve.GetRichCurveConst();
+	if (RichCurve && RichCurve->GetNumKeys() > 0)
+	{
+		return RichCurve->Eval(static_cast<float>(Stage));
+	}
+
+	return FMath::Pow(FallbackBase, static_cast<float>(Stage));
+}
@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Curves/CurveFloat.h"
+#include "DifficultyCurveDataAsset.generated.h"
+
+/** ĳһѶȽ׶εȫ */
+USTRUCT(BlueprintType)
+struct FDifficultyStageScales
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Difficulty")
+	float Health = 1.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Difficulty")
+	float Attack = 1.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Difficulty")
+	float Gold = 1.f;
+
+	/** ˢƵʱʣʵʼ = SpawnInterval / SpawnRate */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Difficulty")
+	float SpawnRate = 1.f;
+};
+
+/**
+ * ѶߣX = ѶȽ׶ΣY = ʣ
+ *
+ * -  / ༭ 0..MaxPrecomputedStage ֵԤƽ飬ʱ O(1) 
+ * - û Key ʱ˻Ϊ Pow(FallbackBase, Stage)Ĭֵԭдĳһ
+ * - ༭޸ԴؽPIE һɾͻЧ
+ * - ⲿ UCurveFloat ʱ༭ⲿ߲֪ͨԴ༭Դ߱ÿֱֵ
+ */
+UCLASS(BlueprintType)
+class ACTIONGAME_API UDifficultyCurveDataAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** O(1) Ԥ㷶Χʱֱֵ */
+	FDifficultyStageScales GetStageScales(int32 Stage) const;
+
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty|Curves")
+	FRuntimeFloatCurve HealthCurve;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty|Curves")
+	FRuntimeFloatCurve AttackCurve;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty|Curves")
+	FRuntimeFloatCurve GoldCurve;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty|Curves")
+	FRuntimeFloatCurve SpawnRateCurve;
+
+	// Ϊʱָ
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty|Fallback")
+	float HealthFallbackBase = 1.18f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty|Fallback")
+	float AttackFallbackBase = 1.12f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty|Fallback")
+	float GoldFallbackBase = 1.10f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty|Fallback")
+	float SpawnRateFallbackBase = 1.f;
+
+	/** ԤĽ׶ 0 */
+	UPROPERTY(EditDefaultsOnly, Category = "Difficulty", meta = (ClampMin = "0"))
+	int32 MaxPrecomputedStage = 60;
+
+private:
+	void RebuildStageTable();
+
+	FDifficultyStageScales EvaluateStage(int32 Stage) const;
+
+	static float EvaluateCurve(const FRuntimeFloatCurve& Curve, float FallbackBase, int32 Stage);
+
+	/** ± = Stage */
+	TArray<FDifficultyStageScales> StageTable;
+
+#if WITH_EDITOR
+	/** һⲿ UCurveFloatܹڣ */
+	bool bUsesExternalCurves = false;
+#endif
+};
@@ -0,0 +1,437 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/AG_AreaDamageSubsystem.h"
+
+#include "ActionGame.h"
+#include "ActionGameplayTags.h"
+#include "ActionGameCollisionChannels.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "AbilitySystem/AG_GameplayEffectContext.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+#include "ActorComponents/AG_EnemyCombatComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+
+DECLARE_CYCLE_STAT(TEXT("Area Damage Flush"), STAT_AG_AreaDamageFlush, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Area Damage Requests"), STAT_AG_AreaDamageRequests, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Area Damage Queries"), STAT_AG_AreaDamageQueries, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Area Damage Specs Built"), STAT_AG_AreaDamageSpecs, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Area Damage Targets Hit"), STAT_AG_AreaDamageTargets, STATGROUP_ActionGame);
+
+void UAG_AreaDamageSubsystem::QueueAreaDamage(const FAreaDamageRequest& Request)
+{
+	PendingRequests.Add(Request);
+	INC_DWORD_STAT(STAT_AG_AreaDamageRequests);
+}
+
+int32 UAG_AreaDamageSubsystem::GatherTargets(
+	const FVector& Origin,
+	float Radius,
+	const AActor* IgnoreActor,
+	TSubclassOf<AActor> TargetClass,
+	const FGameplayTag& IgnoreTargetTag,
+	TArray<UAbilitySystemComponent*>& OutTargets,
+	TArray<UAG_EnemyCombatComponent*>* OutLiteTargets) const
+{
+	UWorld* World = GetWorld();
+	if (!World || Radius <= 0.f)
+	{
+		return 0;
+	}
+
+	FCollisionObjectQueryParams ObjParams;
+	ObjParams.AddObjectTypesToQuery(FAGCollisionChannels::Damageable());
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AreaDamage_Gather), false, IgnoreActor);
+
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByObjectType(
+		Overlaps,
+		Origin,
+		FQuat::Identity,
+		ObjParams,
+		FCollisionShape::MakeSphere(Radius),
+		QueryParams
+	);
+
+	// ͬһɫĽ Mesh ᷵أ Actor ȥ
+	TSet<AActor*> SeenActors;
+	SeenActors.Reserve(Overlaps.Num());
+
+	const int32 StartNum = OutTargets.Num() + (OutLiteTargets ? OutLiteTargets->Num() : 0);
+	for (const FOverlapResult& Result : Overlaps)
+	{
+		AActor* Actor = Result.GetActor();
+		if (!IsValid(Actor) || (TargetClass && !Actor->IsA(TargetClass)))
+		{
+			continue;
+		}
+
+		bool bAlreadySeen = false;
+		SeenActors.Add(Actor, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Actor);
+		if (!TargetASC)
+		{
+			UAG_EnemyCombatComponent* LiteTarget = OutLiteTargets ? UAG_EnemyCombatComponent::FindForActor(Actor) : nullptr;
+			if (LiteTarget && !(IgnoreTargetTag.IsValid() && LiteTarget->HasStateTag(IgnoreTargetTag)))
+			{
+				OutLiteTargets->Add(LiteTarget);
+			}
+			continue;
+		}
+
+		if (IgnoreTargetTag.IsValid() && TargetASC->HasMatchingGameplayTag(IgnoreTargetTag))
+		{
+			continue;
+		}
+
+		OutTargets.Add(TargetASC);
+	}
+
+	return OutTargets.Num() + (OutLiteTargets ? OutLiteTargets->Num() : 0) - StartNum;
+}
+
+int32 UAG_AreaDamageSubsystem::ApplySpecToTargets(
+	UAbilitySystemComponent* SourceASC,
+	const FGameplayEffectSpec& Spec,
+	const TArray<UAbilitySystemComponent*>& Targets)
+{
+	if (!SourceASC)
+	{
+		return 0;
+	}
+
+	int32 NumApplied = 0;
+	for (UAbilitySystemComponent* TargetASC : Targets)
+	{
+		if (!IsValid(TargetASC))
+		{
+			continue;
+		}
+
+		SourceASC->ApplyGameplayEffectSpecToTarget(Spec, TargetASC);
+		++NumApplied;
+	}
+
+	INC_DWORD_STAT_BY(STAT_AG_AreaDamageTargets, NumApplied);
+	return NumApplied;
+}
+
+int32 UAG_AreaDamageSubsystem::ApplySpecToLiteTargets(
+	const FGameplayEffectSpec& Spec,
+	const FGameplayTag& DataTag,
+	const TArray<UAG_EnemyCombatComponent*>& Targets)
+{
+	int32 NumApplied = 0;
+	for (UAG_EnemyCombatComponent* Target : Targets)
+	{
+		if (!IsValid(Target))
+		{
+			continue;
+		}
+
+		Target->ApplyGameplayEffectSpec(Spec, DataTag);
+		++NumApplied;
+	}
+
+	INC_DWORD_STAT_BY(STAT_AG_AreaDamageTargets, NumApplied);
+	return NumApplied;
+}
+
+void UAG_AreaDamageSubsystem::ApplyFromTarget(UAbilitySystemComponent* TargetASC, const FAreaDamageRequest& Request, AActor* Instigator)
+{
+	FGameplayEffectContextHandle Context = TargetASC->MakeEffectContext();
+	Context.AddInstigator(Instigator, Instigator);
+	Context.AddSourceObject(Instigator);
+	Context.AddOrigin(Request.Origin);
+	if (FAGGameplayEffectContext* AGContext = FAGGameplayEffectContext::Get(Context))
+	{
+		AGContext->SetDamageArchetype(EAGDamageArchetype::Explosion);
+	}
+
+	// ģ建棺Ŀ ASC ֻ Spec 壬ըģ岻ܽܺߵĻ
+	FGameplayEffectSpecHandle Spec = TargetASC->MakeOutgoingSpec(Request.EffectClass, Request.Level, Context);
+	if (Spec.IsValid())
+	{
+		Spec.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Damage, Request.LiteSourceDamage);
+		TargetASC->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+	}
+}
+
+bool UAG_AreaDamageSubsystem::RejectLiteSourceEffect(TSubclassOf<UGameplayEffect> EffectClass)
+{
+	TArray<FGameplayEffectAttributeCaptureDefinition> CaptureDefs;
+	EffectClass.GetDefaultObject()->GetAttributeCaptureDefinitions(CaptureDefs);
+
+	const bool bCapturesSource = CaptureDefs.ContainsByPredicate([](const FGameplayEffectAttributeCaptureDefinition& Def)
+	{
+		return Def.AttributeSource == EGameplayEffectAttributeCaptureSource::Source;
+	});
+
+	if (bCapturesSource && !RejectedLiteSourceEffects.Contains(EffectClass.Get()))
+	{
+		RejectedLiteSourceEffects.Add(EffectClass.Get());
+		UE_LOG(LogActionGame, Warning,
+			TEXT("AreaDamage: %s captures source attributes and cannot be used by a source without an ASC, use SetByCaller Data.Damage"),
+			*GetNameSafe(EffectClass.Get()));
+	}
+	return bCapturesSource;
+}
+
+void UAG_AreaDamageSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingRequests.Num() > 0)
+	{
+		FlushRequests();
+	}
+}
+
+TStatId UAG_AreaDamageSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAG_AreaDamageSubsystem, STATGROUP_Tickables);
+}
+
+bool UAG_AreaDamageSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAG_AreaDamageSubsystem::BuildRequestGroups(const TArray<FBox>& Bounds, TArray<int32>& OutGroups)
+{
+	// 鼯ΧཻΪһ飬OutGroups[i] ΪС±
+	OutGroups.SetNumUninitialized(Bounds.Num());
+	for (int32 Index = 0; Index < Bounds.Num(); ++Index)
+	{
+		OutGroups[Index] = Index;
+	}
+
+	auto FindRoot = [&OutGroups](int32 Index)
+	{
+		while (OutGroups[Index] != Index)
+		{
+			OutGroups[Index] = OutGroups[OutGroups[Index]];
+			Index = OutGroups[Index];
+		}
+		return Index;
+	};
+
+	for (int32 A = 0; A < Bounds.Num(); ++A)
+	{
+		for (int32 B = A + 1; B < Bounds.Num(); ++B)
+		{
+			if (!Bounds[A].Intersect(Bounds[B]))
+			{
+				continue;
+			}
+
+			const int32 RootA = FindRoot(A);
+			const int32 RootB = FindRoot(B);
+			if (RootA != RootB)
+			{
+				OutGroups[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+			}
+		}
+	}
+
+	for (int32 Index = 0; Index < Bounds.Num(); ++Index)
+	{
+		OutGroups[Index] = FindRoot(Index);
+	}
+}
+
+void UAG_AreaDamageSubsystem::FlushRequests()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AG_AreaDamageFlush);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		PendingRequests.Reset();
+		return;
+	}
+
+	// вըһ֡
+	TArray<FAreaDamageRequest> Requests = MoveTemp(PendingRequests);
+	PendingRequests.Reset();
+
+	// 1) Χཻ飬ÿֻһοռѯԶıըϳһȫͼİΧУ
+	TArray<FBox> RequestBounds;
+	RequestBounds.Reserve(Requests.Num());
+	for (const FAreaDamageRequest& Request : Requests)
+	{
+		RequestBounds.Add(FBox::BuildAABB(Request.Origin, FVector(Request.Radius)));
+	}
+
+	TArray<int32> Groups;
+	BuildRequestGroups(RequestBounds, Groups);
+
+	// ÿֻԼΧڵ Overlap 
+	TArray<TArray<FOverlapResult>> RequestOverlaps;
+	RequestOverlaps.SetNum(Requests.Num());
+
+	FCollisionObjectQueryParams ObjParams;
+	ObjParams.AddObjectTypesToQuery(FAGCollisionChannels::Damageable());
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AreaDamage), false);
+
+	TArray<FOverlapResult> Overlaps;
+	TArray<int32> GroupMembers;
+
+	for (int32 GroupRoot = 0; GroupRoot < Requests.Num(); ++GroupRoot)
+	{
+		if (Groups[GroupRoot] != GroupRoot)
+		{
+			continue;
+		}
+
+		FBox GroupBounds(ForceInit);
+		GroupMembers.Reset();
+		for (int32 Index = GroupRoot; Index < Requests.Num(); ++Index)
+		{
+			if (Groups[Index] == GroupRoot)
+			{
+				GroupBounds += RequestBounds[Index];
+				GroupMembers.Add(Index);
+			}
+		}
+
+		Overlaps.Reset();
+		World->OverlapMultiByObjectType(
+			Overlaps,
+			GroupBounds.GetCenter(),
+			FQuat::Identity,
+			ObjParams,
+			FCollisionShape::MakeBox(GroupBounds.GetExtent()),
+			QueryParams
+		);
+		INC_DWORD_STAT(STAT_AG_AreaDamageQueries);
+
+		for (const FOverlapResult& Result : Overlaps)
+		{
+			const UPrimitiveComponent* Component = Result.GetComponent();
+			if (!Component)
+			{
+				continue;
+			}
+
+			for (const int32 Index : GroupMembers)
+			{
+				// УΧ
+				const float ReachRadius = Requests[Index].Radius + Component->Bounds.SphereRadius;
+				if (FVector::DistSquared(Component->Bounds.Origin, Requests[Index].Origin) <= ReachRadius * ReachRadius)
+				{
+					RequestOverlaps[Index].Add(Result);
+				}
+			}
+		}
+	}
+
+	// 2) ͬһԭ͹һ Specÿֻ Context
+	TMap<TTuple<UAbilitySystemComponent*, UClass*, float>, FGameplayEffectSpecHandle> SpecCache;
+	TSet<ACharacter*> AffectedActors;
+
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+	{
+		const FAreaDamageRequest& Request = Requests[RequestIndex];
+		AActor* Instigator = Request.Instigator.Get();
+		UAbilitySystemComponent* SourceASC = Request.SourceASC.Get();
+
+		if (Request.EffectClass)
+		{
+			// û ASCSpec ÿĿԼ· ApplyFromTargetֻ SetByCaller ˺
+			FGameplayEffectSpecHandle SharedSpec;
+			const bool bRejected = !SourceASC && RejectLiteSourceEffect(Request.EffectClass);
+			if (SourceASC)
+			{
+				FGameplayEffectSpecHandle& Cached = SpecCache.FindOrAdd(MakeTuple(SourceASC, Request.EffectClass.Get(), Request.Level));
+				if (!Cached.IsValid())
+				{
+					Cached = UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(SourceASC, Request.EffectClass, Request.Level, SourceASC->MakeEffectContext());
+					INC_DWORD_STAT(STAT_AG_AreaDamageSpecs);
+				}
+				SharedSpec = Cached;
+			}
+
+			if ((!SourceASC && !bRejected) || SharedSpec.IsValid())
+			{
+				if (SharedSpec.IsValid())
+				{
+					FGameplayEffectContextHandle Context = SourceASC->MakeEffectContext();
+					Context.AddInstigator(Instigator, Instigator);
+					Context.AddSourceObject(Instigator);
+					Context.AddOrigin(Request.Origin);
+					if (FAGGameplayEffectContext* AGContext = FAGGameplayEffectContext::Get(Context))
+					{
+						AGContext->SetDamageArchetype(EAGDamageArchetype::Explosion);
+					}
+					SharedSpec.Data->SetContext(Context);
+				}
+
+				const FCollisionShape Sphere = FCollisionShape::MakeSphere(Request.Radius);
+
+				AffectedActors.Reset();
+
+				for (const FOverlapResult& Result : RequestOverlaps[RequestIndex])
+				{
+					ACharacter* Character = Cast<ACharacter>(Result.GetActor());
+					UPrimitiveComponent* Component = Result.GetComponent();
+					if (!IsValid(Character) || Character == Instigator || !Component)
+					{
+						continue;
+					}
+
+					if (AffectedActors.Contains(Character))
+					{
+						continue;
+					}
+
+					// խλԭը Overlap Ľһ
+					if (!Component->OverlapComponent(Request.Origin, FQuat::Identity, Sphere))
+					{
+						continue;
+					}
+
+					AffectedActors.Add(Character);
+
+					UAbilitySystemComponent* TargetASC =
+						UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Character);
+					if (!TargetASC)
+					{
+						continue;
+					}
+
+					// ĿʩЧ
+					if (Request.IgnoreTargetTag.IsValid() && TargetASC->HasMatchingGameplayTag(Request.IgnoreTargetTag))
+					{
+						continue;
+					}
+
+					if (SharedSpec.IsValid())
+					{
+						SourceASC->ApplyGameplayEffectSpecToTarget(*SharedSpec.Data.Get(), TargetASC);
+					}
+					else
+					{
+						ApplyFromTarget(TargetASC, Request, Instigator);
+					}
+					INC_DWORD_STAT(STAT_AG_AreaDamageTargets);
+				}
+			}
+		}
+
+		if (Request.bDestroyInstigator && IsValid(Instigator))
+		{
+			Instigator->Destroy();
+		}
+	}
+}
@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
+#include "AG_AreaDamageSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+class UAG_EnemyCombatComponent;
+
+/** һηΧ˺󣨱ըȣ */
+struct FAreaDamageRequest
+{
+	/** ըԴд Context  Instigator/SourceObject */
+	TWeakObjectPtr<AActor> Instigator;
+
+	TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+
+	/**
+	 * SourceASC ΪգˣʱGE ֻܿ SetByCaller ȡ˺ֵ
+	 * ԴԵ GE ᱻܾ򲶻񵽵ܺԼԣ
+	 */
+	TSubclassOf<UGameplayEffect> EffectClass;
+
+	float Level = 1.f;
+
+	/** SourceASC Ϊʱд Data.Damage ֵΪ˺ͨΪ -GetAttackDamage() */
+	float LiteSourceDamage = 0.f;
+
+	FVector Origin = FVector::ZeroVector;
+
+	float Radius = 0.f;
+
+	/** Ŀ Tag ʱ State.Dead */
+	FGameplayTag IgnoreTargetTag;
+
+	/** ɺ InstigatorԱˣ */
+	bool bDestroyInstigator = false;
+};
+
+/**
+ * Χ˺񣨽
+ * һ֡ڵıըŶӣ֡ĩͳһ㣺
+ * - ΧཻΪһ飬ÿһοռѯͰխλж
+ * - ÿ TSet ȥأͬһĿֻһ˺
+ * - ͬһԭͣSource ASC + GE + Levelֻһ SpecĿ깲
+ */
+UCLASS()
+class ACTIONGAME_API UAG_AreaDamageSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void QueueAreaDamage(const FAreaDamageRequest& Request);
+
+	/**
+	 * ģʽһοռѯռ뾶ڵĿ ASC Actor ȥأ
+	 * TargetClass Ϊʱͣ IgnoreTargetTag Ŀ
+	 *  OutLiteTargets ʱû ASC ռԣ
+	 */
+	int32 GatherTargets(
+		const FVector& Origin,
+		float Radius,
+		const AActor* IgnoreActor,
+		TSubclassOf<AActor> TargetClass,
+		const FGameplayTag& IgnoreTargetTag,
+		TArray<UAbilitySystemComponent*>& OutTargets,
+		TArray<UAG_EnemyCombatComponent*>* OutLiteTargets = nullptr) const;
+
+	/** ͬһ Spec һӦõĿ꣬ Spec */
+	static int32 ApplySpecToTargets(
+		UAbilitySystemComponent* SourceASC,
+		const FGameplayEffectSpec& Spec,
+		const TArray<UAbilitySystemComponent*>& Targets);
+
+	/** ˣͬһ Spec ȡ DataTag  SetByCaller ˺ */
+	static int32 ApplySpecToLiteTargets(
+		const FGameplayEffectSpec& Spec,
+		const FGameplayTag& DataTag,
+		const TArray<UAG_EnemyCombatComponent*>& Targets);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void FlushRequests();
+
+	/** ΧཻΪһ飬OutGroups[i] Ϊ i С± */
+	static void BuildRequestGroups(const TArray<FBox>& Bounds, TArray<int32>& OutGroups);
+
+	/**
+	 * Դû ASCˣʱĿ ASC һ Spec Ӧ
+	 * ˺ֵ Request.LiteSourceDamageSetByCaller Data.DamageĿģ建
+	 */
+	static void ApplyFromTarget(UAbilitySystemComponent* TargetASC, const FAreaDamageRequest& Request, AActor* Instigator);
+
+	/** GE Ƿ񲶻ԴԣԴʹãÿ GE ֻһ */
+	bool RejectLiteSourceEffect(TSubclassOf<UGameplayEffect> EffectClass);
+
+	TArray<FAreaDamageRequest> PendingRequests;
+
+	TSet<TObjectKey<UClass>> RejectedLiteSourceEffects;
+};
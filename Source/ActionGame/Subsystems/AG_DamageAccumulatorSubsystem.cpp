@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/AG_DamageAccumulatorSubsystem.h"
+
+#include "ActionGame.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+
+DECLARE_CYCLE_STAT(TEXT("Damage Accumulator Flush"), STAT_AG_DamageFlush, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Events Queued"), STAT_AG_DamageEventsQueued, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Events Immediate"), STAT_AG_DamageEventsImmediate, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Applications (Combined)"), STAT_AG_DamageApplications, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarDamageAggregate(
+	TEXT("ag.Damage.Aggregate"),
+	1,
+	TEXT("Combine SetByCaller damage per target per frame (0 = apply every hit immediately)"),
+	ECVF_Default
+);
+
+void UAG_DamageAccumulatorSubsystem::ApplyDamage(
+	const UObject* WorldContextObject,
+	UAbilitySystemComponent* SourceASC,
+	UAbilitySystemComponent* TargetASC,
+	TSubclassOf<UGameplayEffect> EffectClass,
+	float Level,
+	const FGameplayTag& DataTag,
+	float Magnitude,
+	const FGameplayEffectContextHandle& Context)
+{
+	if (!SourceASC || !TargetASC || !EffectClass)
+	{
+		return;
+	}
+
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UAG_DamageAccumulatorSubsystem* Accumulator = World ? World->GetSubsystem<UAG_DamageAccumulatorSubsystem>() : nullptr;
+
+	if (!Accumulator || !DataTag.IsValid() || ShouldApplyImmediately(EffectClass))
+	{
+		ApplyNow(SourceASC, TargetASC, EffectClass, Level, DataTag, Magnitude, Context);
+		INC_DWORD_STAT(STAT_AG_DamageEventsImmediate);
+		return;
+	}
+
+	Accumulator->QueueDamage(SourceASC, TargetASC, EffectClass, Level, DataTag, Magnitude, Context);
+}
+
+bool UAG_DamageAccumulatorSubsystem::ShouldApplyImmediately(TSubclassOf<UGameplayEffect> EffectClass)
+{
+	if (CVarDamageAggregate.GetValueOnGameThread() == 0)
+	{
+		return true;
+	}
+
+	// ˺ãGE Դϴ Damage.Immediate ǩ
+	const UGameplayEffect* EffectCDO = EffectClass.GetDefaultObject();
+	return EffectCDO && EffectCDO->GetAssetTags().HasTag(AGGameplayTags::Damage_Immediate);
+}
+
+void UAG_DamageAccumulatorSubsystem::ApplyNow(
+	UAbilitySystemComponent* SourceASC,
+	UAbilitySystemComponent* TargetASC,
+	TSubclassOf<UGameplayEffect> EffectClass,
+	float Level,
+	const FGameplayTag& DataTag,
+	float Magnitude,
+	const FGameplayEffectContextHandle& Context)
+{
+	FGameplayEffectSpecHandle SpecHandle =
+		UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(SourceASC, EffectClass, Level, Context);
+
+	if (!SpecHandle.IsValid())
+	{
+		return;
+	}
+
+	if (DataTag.IsValid())
+	{
+		SpecHandle.Data->SetSetByCallerMagnitude(DataTag, Magnitude);
+	}
+
+	SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+}
+
+void UAG_DamageAccumulatorSubsystem::QueueDamage(
+	UAbilitySystemComponent* SourceASC,
+	UAbilitySystemComponent* TargetASC,
+	TSubclassOf<UGameplayEffect> EffectClass,
+	float Level,
+	const FGameplayTag& DataTag,
+	float Magnitude,
+	const FGameplayEffectContextHandle& Context)
+{
+	const TTuple<const UAbilitySystemComponent*, const UAbilitySystemComponent*, const UClass*, float, FGameplayTag> Key(
+		TargetASC, SourceASC, EffectClass.Get(), Level, DataTag);
+
+	int32& Index = PendingIndex.FindOrAdd(Key, INDEX_NONE);
+	if (Index == INDEX_NONE)
+	{
+		Index = PendingDamage.AddDefaulted();
+
+		FPendingTargetDamage& NewPending = PendingDamage[Index];
+		NewPending.TargetASC = TargetASC;
+		NewPending.SourceASC = SourceASC;
+		NewPending.EffectClass = EffectClass;
+		NewPending.Level = Level;
+		NewPending.DataTag = DataTag;
+	}
+
+	FPendingTargetDamage& Pending = PendingDamage[Index];
+	Pending.Magnitude += Magnitude;
+	Pending.Context = Context;
+
+	INC_DWORD_STAT(STAT_AG_DamageEventsQueued);
+}
+
+void UAG_DamageAccumulatorSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingDamage.Num() > 0)
+	{
+		FlushPendingDamage();
+	}
+}
+
+TStatId UAG_DamageAccumulatorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAG_DamageAccumulatorSubsystem, STATGROUP_Tickables);
+}
+
+bool UAG_DamageAccumulatorSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAG_DamageAccumulatorSubsystem::FlushPendingDamage()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AG_DamageFlush);
+
+	// в˺ˡһ֡
+	TArray<FPendingTargetDamage> Flushing = MoveTemp(PendingDamage);
+	PendingDamage.Reset();
+	PendingIndex.Reset();
+
+	// ״е˳㣬˭ GE ѪԱ
+	for (const FPendingTargetDamage& Pending : Flushing)
+	{
+		UAbilitySystemComponent* TargetASC = Pending.TargetASC.Get();
+		UAbilitySystemComponent* SourceASC = Pending.SourceASC.Get();
+		if (!TargetASC || !SourceASC)
+		{
+			continue;
+		}
+
+		ApplyNow(SourceASC, TargetASC, Pending.EffectClass, Pending.Level, Pending.DataTag, Pending.Magnitude, Pending.Context);
+		INC_DWORD_STAT(STAT_AG_DamageApplications);
+	}
+}
@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
+#include "AG_DamageAccumulatorSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/** ͬһ֡ͬһԴͬһȼ䵽ͬһĿꡢͬһ˺ϵ˺ */
+struct FPendingTargetDamage
+{
+	TWeakObjectPtr<UAbilitySystemComponent> TargetASC;
+
+	TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+
+	TSubclassOf<UGameplayEffect> EffectClass;
+
+	float Level = 1.f;
+
+	FGameplayTag DataTag;
+
+	/** SetByCaller ֮ͣ˺Ϊ */
+	float Magnitude = 0.f;
+
+	/** һе ContextϢ Cue ã */
+	FGameplayEffectContextHandle Context;
+};
+
+/**
+ * ˺ۺϣ
+ * һ֡ͬһԴͬһȼ䵽ͬһĿͬһ˺ͣGE + SetByCaller Tagϵ˺ۼӣ
+ * ֡ĩÿԴִֻһ GEԾۺϡơOnHealthChanged鶼߼
+ * - ͬԴ / ȼֿ㣬ԴԲִм㡢˺ͳƶԵԴ
+ * - ɱԴ֡һе˳㣬ʵʰѪյǴ GE 
+ * - GE Դ Damage.Immediate ǩ ag.Damage.Aggregate Ϊ 0 ʱ
+ */
+UCLASS()
+class ACTIONGAME_API UAG_DamageAccumulatorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * ύһ SetByCaller ˺ɾۺʱӣ Apply
+	 * ûоۺϵͳͻ/Ϸ磩ʱͬ Apply
+	 */
+	static void ApplyDamage(
+		const UObject* WorldContextObject,
+		UAbilitySystemComponent* SourceASC,
+		UAbilitySystemComponent* TargetASC,
+		TSubclassOf<UGameplayEffect> EffectClass,
+		float Level,
+		const FGameplayTag& DataTag,
+		float Magnitude,
+		const FGameplayEffectContextHandle& Context);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	static bool ShouldApplyImmediately(TSubclassOf<UGameplayEffect> EffectClass);
+
+	static void ApplyNow(
+		UAbilitySystemComponent* SourceASC,
+		UAbilitySystemComponent* TargetASC,
+		TSubclassOf<UGameplayEffect> EffectClass,
+		float Level,
+		const FGameplayTag& DataTag,
+		float Magnitude,
+		const FGameplayEffectContextHandle& Context);
+
+	void QueueDamage(
+		UAbilitySystemComponent* SourceASC,
+		UAbilitySystemComponent* TargetASC,
+		TSubclassOf<UGameplayEffect> EffectClass,
+		float Level,
+		const FGameplayTag& DataTag,
+		float Magnitude,
+		const FGameplayEffectContextHandle& Context);
+
+	void FlushPendingDamage();
+
+	TArray<FPendingTargetDamage> PendingDamage;
+
+	/** (Target, Source, GE, Level, DataTag) -> PendingDamage ± */
+	TMap<TTuple<const UAbilitySystemComponent*, const UAbilitySystemComponent*, const UClass*, float, FGameplayTag>, int32> PendingIndex;
+};
@@ -0,0 +1,181 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/AG_DeathQueueSubsystem.h"
+
+#include "ActionGame.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbilityTypes.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+#include "Characters/EnemyCharacterBase.h"
+
+DECLARE_CYCLE_STAT(TEXT("Death Processing"), STAT_AG_DeathProcessing, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deaths Processed"), STAT_AG_DeathsProcessed, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Deaths Pending"), STAT_AG_DeathsPending, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bounty Contributions"), STAT_AG_BountyContributions, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bounty Payouts"), STAT_AG_BountyPayouts, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarDeathMaxPerFrame(
+	TEXT("ag.Death.MaxPerFrame"),
+	8,
+	TEXT("Max number of queued deaths processed per frame (<= 0 processes all)"),
+	ECVF_Default
+);
+
+void UAG_DeathQueueSubsystem::QueueDeath(AActor* Victim, AActor* Instigator, const FGameplayTag& EventTag)
+{
+	if (!Victim)
+	{
+		return;
+	}
+
+	FPendingDeath& Death = PendingDeaths.AddDefaulted_GetRef();
+	Death.Victim = Victim;
+	Death.Instigator = Instigator;
+	Death.EventTag = EventTag;
+}
+
+void UAG_DeathQueueSubsystem::AddBounty(AActor* Killer, TSubclassOf<UGameplayEffect> RewardEffect, float Gold, AActor* Victim)
+{
+	if (!Killer || !RewardEffect || Gold <= 0.f)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_AG_BountyContributions);
+
+	FPendingBounty* Bounty = PendingBounties.FindByPredicate([Killer, &RewardEffect](const FPendingBounty& Pending)
+	{
+		return Pending.Killer.Get() == Killer && Pending.RewardEffect == RewardEffect;
+	});
+
+	if (!Bounty)
+	{
+		Bounty = &PendingBounties.AddDefaulted_GetRef();
+		Bounty->Killer = Killer;
+		Bounty->RewardEffect = RewardEffect;
+	}
+
+	Bounty->Gold += Gold;
+	Bounty->LastVictim = Victim;
+}
+
+void UAG_DeathQueueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (NextIndex < PendingDeaths.Num())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AG_DeathProcessing);
+
+		const int32 Budget = CVarDeathMaxPerFrame.GetValueOnGameThread();
+		const int32 EndIndex = (Budget > 0) ? FMath::Min(PendingDeaths.Num(), NextIndex + Budget) : PendingDeaths.Num();
+
+		// пµӣݣ±ʲһ
+		for (; NextIndex < EndIndex; ++NextIndex)
+		{
+			const FPendingDeath Death = PendingDeaths[NextIndex];
+			ProcessDeath(Death);
+		}
+
+		if (NextIndex >= PendingDeaths.Num())
+		{
+			PendingDeaths.Reset();
+			NextIndex = 0;
+		}
+
+		SET_DWORD_STAT(STAT_AG_DeathsPending, PendingDeaths.Num() - NextIndex);
+	}
+
+	if (PendingBounties.Num() > 0)
+	{
+		FlushBounties();
+	}
+}
+
+void UAG_DeathQueueSubsystem::ProcessDeath(const FPendingDeath& Death)
+{
+	AActor* Victim = Death.Victim.Get();
+	if (!IsValid(Victim))
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_AG_DeathsProcessed);
+
+	AEnemyCharacterBase* Enemy = Cast<AEnemyCharacterBase>(Victim);
+	if (Enemy && Enemy->GetDeathEffectClass())
+	{
+		ProcessEnemyDeath(Enemy, Death.Instigator.Get());
+		return;
+	}
+
+	// ̣ϵ GA
+	FGameplayEventData Payload;
+	Payload.EventTag = Death.EventTag;
+	Payload.Instigator = Death.Instigator.Get();
+
+	UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(Victim, Death.EventTag, Payload);
+}
+
+void UAG_DeathQueueSubsystem::ProcessEnemyDeath(AEnemyCharacterBase* Enemy, AActor* Killer)
+{
+	// 1) ״̬DeathEffect  State.Dead / State.Ragdollɵ˵ Tag ص
+	// ÿֻһΣģ建ߵ ASC ûиüֵ
+	if (UAbilitySystemComponent* VictimASC = Enemy->GetAbilitySystemComponent())
+	{
+		FGameplayEffectSpecHandle DeathSpec = VictimASC->MakeOutgoingSpec(
+			Enemy->GetDeathEffectClass(), 1.f, VictimASC->MakeEffectContext());
+
+		if (DeathSpec.IsValid())
+		{
+			VictimASC->ApplyGameplayEffectSpecToSelf(*DeathSpec.Data.Get());
+		}
+	}
+
+	// 2) ͽۼӣ֡ĩϲ
+	AddBounty(Killer, Enemy->GetRewardEffectClass(), Enemy->GetBountyGold(), Enemy);
+}
+
+void UAG_DeathQueueSubsystem::FlushBounties()
+{
+	TArray<FPendingBounty> Bounties = MoveTemp(PendingBounties);
+	PendingBounties.Reset();
+
+	for (const FPendingBounty& Bounty : Bounties)
+	{
+		UAbilitySystemComponent* KillerASC =
+			UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Bounty.Killer.Get());
+		if (!KillerASC)
+		{
+			continue;
+		}
+
+		FGameplayEffectContextHandle RewardCtx = KillerASC->MakeEffectContext();
+		RewardCtx.AddSourceObject(Bounty.LastVictim.Get());
+
+		FGameplayEffectSpecHandle RewardSpec =
+			UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(KillerASC, Bounty.RewardEffect, 1.f, RewardCtx);
+		if (!RewardSpec.IsValid())
+		{
+			continue;
+		}
+
+		RewardSpec.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Reward_Gold, Bounty.Gold);
+		KillerASC->ApplyGameplayEffectSpecToSelf(*RewardSpec.Data.Get());
+		INC_DWORD_STAT(STAT_AG_BountyPayouts);
+	}
+}
+
+TStatId UAG_DeathQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAG_DeathQueueSubsystem, STATGROUP_Tickables);
+}
+
+bool UAG_DeathQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
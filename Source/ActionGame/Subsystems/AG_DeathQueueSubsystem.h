@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "AG_DeathQueueSubsystem.generated.h"
+
+class UGameplayEffect;
+class AEnemyCharacterBase;
+
+/** һ */
+struct FPendingDeath
+{
+	TWeakObjectPtr<AActor> Victim;
+
+	/** ɱߣ */
+	TWeakObjectPtr<AActor> Instigator;
+
+	/** ̣ Victim ¼û DeathEffect ĵˣ */
+	FGameplayTag EventTag;
+};
+
+/** ͬһ֡ͬһɱߡͬһ GE ۼƵͽ */
+struct FPendingBounty
+{
+	TWeakObjectPtr<AActor> Killer;
+
+	TSubclassOf<UGameplayEffect> RewardEffect;
+
+	float Gold = 0.f;
+
+	/** һͽߣд Context  SourceObject */
+	TWeakObjectPtr<AActor> LastVictim;
+};
+
+/**
+ * 
+ * Ѫʱӣÿ֡Ԥ㣨ag.Death.MaxPerFrame
+ * -  DeathEffect ĵֱ㣬Ҫÿ貢 GA
+ *   - Ӧ DeathEffectState.Dead / State.Ragdoll޵ȱ Tag ص
+ *   - ͽ𰴻ɱۼӣ֡ĩÿɱֻӦһν GE
+ * - þ̣ɷ¼ GA
+ */
+UCLASS()
+class ACTIONGAME_API UAG_DeathQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void QueueDeath(AActor* Victim, AActor* Instigator, const FGameplayTag& EventTag);
+
+	/** ۼͽ֡ĩϲţ˵Ҳ */
+	void AddBounty(AActor* Killer, TSubclassOf<UGameplayEffect> RewardEffect, float Gold, AActor* Victim);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void ProcessDeath(const FPendingDeath& Death);
+
+	void ProcessEnemyDeath(AEnemyCharacterBase* Enemy, AActor* Killer);
+
+	void FlushBounties();
+
+	TArray<FPendingDeath> PendingDeaths;
+
+	/** һ±꣬ÿ֡ RemoveAt(0)  */
+	int32 NextIndex = 0;
+
+	/** ɱ٣ңԲҼ */
+	TArray<FPendingBounty> PendingBounties;
+};
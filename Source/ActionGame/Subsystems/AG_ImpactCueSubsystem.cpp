@@ -0,0 +1,231 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/AG_ImpactCueSubsystem.h"
+
+#include "ActionGame.h"
+#include "ActionGamePlayerController.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GameplayCueManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Impact Cues Queued"), STAT_AG_ImpactCuesQueued, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Impact Cues Sent"), STAT_AG_ImpactCuesSent, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Impact Cues Culled"), STAT_AG_ImpactCuesCulled, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Impact Cue RPCs"), STAT_AG_ImpactCueRPCs, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarImpactCueBatch(
+	TEXT("ag.ImpactCues.Batch"),
+	1,
+	TEXT("Batch impact gameplay cues into one packed RPC per connection\n")
+	TEXT(" 0: off (one multicast ExecuteGameplayCue per hit)\n")
+	TEXT(" 1: on"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarImpactCueRelevancy(
+	TEXT("ag.ImpactCues.RelevancyDistance"),
+	6000.f,
+	TEXT("Impact cues farther than this from a player's view target are not sent to that player"),
+	ECVF_Default
+);
+
+namespace ImpactCue
+{
+	//  Unreliable RPC ڵ¼ޣ
+	constexpr int32 MaxEventsPerRPC = 64;
+}
+
+bool FImpactCueEvent::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bool bLocationOk = true;
+	bool bNormalOk = true;
+	bool bTagOk = true;
+
+	Location.NetSerialize(Ar, Map, bLocationOk);
+	Normal.NetSerialize(Ar, Map, bNormalOk);
+	Ar << SurfaceType;
+	CueTag.NetSerialize(Ar, Map, bTagOk);
+
+	if (Map)
+	{
+		UObject* InstigatorObj = Instigator;
+		Map->SerializeObject(Ar, AActor::StaticClass(), InstigatorObj);
+		if (Ar.IsLoading())
+		{
+			Instigator = Cast<AActor>(InstigatorObj);
+		}
+	}
+
+	bOutSuccess = bLocationOk && bNormalOk && bTagOk;
+	return true;
+}
+
+void UAG_ImpactCueSubsystem::QueueImpactCue(const FGameplayTag& CueTag, const FHitResult& Hit, AActor* Instigator)
+{
+	if (!CueTag.IsValid())
+	{
+		return;
+	}
+
+	// ·ಥڶԱ RPC /
+	if (CVarImpactCueBatch.GetValueOnGameThread() == 0)
+	{
+		if (UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Instigator))
+		{
+			FGameplayCueParameters Params;
+			Params.Location = Hit.ImpactPoint;
+			Params.Normal = Hit.ImpactNormal;
+			Params.PhysicalMaterial = Hit.PhysMaterial;
+			Params.Instigator = Instigator;
+			Params.EffectCauser = Instigator;
+
+			ASC->ExecuteGameplayCue(CueTag, Params);
+		}
+		return;
+	}
+
+	FImpactCueEvent& Event = PendingEvents.AddDefaulted_GetRef();
+	Event.Location = Hit.ImpactPoint;
+	Event.Normal = Hit.ImpactNormal;
+	Event.SurfaceType = (uint8)UPhysicalMaterial::DetermineSurfaceType(Hit.PhysMaterial.Get());
+	Event.CueTag = CueTag;
+	Event.Instigator = Instigator;
+
+	INC_DWORD_STAT(STAT_AG_ImpactCuesQueued);
+}
+
+void UAG_ImpactCueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingEvents.Num() > 0)
+	{
+		FlushPendingEvents();
+	}
+}
+
+TStatId UAG_ImpactCueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAG_ImpactCueSubsystem, STATGROUP_Tickables);
+}
+
+bool UAG_ImpactCueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAG_ImpactCueSubsystem::FlushPendingEvents()
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		PendingEvents.Reset();
+		return;
+	}
+
+	const float Relevancy = CVarImpactCueRelevancy.GetValueOnGameThread();
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		AActionGamePlayerController* PC = Cast<AActionGamePlayerController>(It->Get());
+		if (!PC)
+		{
+			continue;
+		}
+
+		const AActor* ViewTarget = PC->GetViewTarget();
+		const FVector ViewLocation = ViewTarget ? ViewTarget->GetActorLocation() : PC->GetSpawnLocation();
+		const APawn* OwnPawn = PC->GetPawn();
+
+		const int32 NumCulled = GatherRelevantEvents(PendingEvents, ViewLocation, OwnPawn, Relevancy, ScratchBatch);
+		INC_DWORD_STAT_BY(STAT_AG_ImpactCuesCulled, NumCulled);
+
+		if (ScratchBatch.Num() > 0)
+		{
+			SendToController(PC, ScratchBatch);
+		}
+	}
+
+	PendingEvents.Reset();
+}
+
+int32 UAG_ImpactCueSubsystem::GatherRelevantEvents(const TArray<FImpactCueEvent>& Events, const FVector& ViewLocation, const AActor* OwnPawn,
+	float RelevancyDistance, TArray<FImpactCueEvent>& OutBatch)
+{
+	const float RelevancySq = RelevancyDistance * RelevancyDistance;
+
+	OutBatch.Reset();
+	int32 NumCulled = 0;
+	for (const FImpactCueEvent& Event : Events)
+	{
+		// ԼǷ
+		if (Event.Instigator != OwnPawn && FVector::DistSquared(ViewLocation, Event.Location) > RelevancySq)
+		{
+			++NumCulled;
+			continue;
+		}
+		OutBatch.Add(Event);
+	}
+	return NumCulled;
+}
+
+int32 UAG_ImpactCueSubsystem::GetNumRPCsForBatch(int32 NumEvents)
+{
+	return FMath::DivideAndRoundUp(FMath::Max(0, NumEvents), ImpactCue::MaxEventsPerRPC);
+}
+
+void UAG_ImpactCueSubsystem::SendToController(AActionGamePlayerController* PC, const TArray<FImpactCueEvent>& Batch)
+{
+	INC_DWORD_STAT_BY(STAT_AG_ImpactCuesSent, Batch.Num());
+
+	// ıͬ RPCֱڱִУԶӵĲһ
+	if (Batch.Num() <= ImpactCue::MaxEventsPerRPC)
+	{
+		INC_DWORD_STAT(STAT_AG_ImpactCueRPCs);
+		PC->ClientReceiveImpactCues(Batch);
+		return;
+	}
+
+	TArray<FImpactCueEvent> Chunk;
+	for (int32 Start = 0; Start < Batch.Num(); Start += ImpactCue::MaxEventsPerRPC)
+	{
+		const int32 Count = FMath::Min(ImpactCue::MaxEventsPerRPC, Batch.Num() - Start);
+		Chunk.Reset();
+		Chunk.Append(Batch.GetData() + Start, Count);
+
+		INC_DWORD_STAT(STAT_AG_ImpactCueRPCs);
+		PC->ClientReceiveImpactCues(Chunk);
+	}
+}
+
+void UAG_ImpactCueSubsystem::DispatchImpactCues(const TArray<FImpactCueEvent>& Events, AActor* FallbackTarget)
+{
+	UGameplayCueManager* CueManager = UAbilitySystemGlobals::Get().GetGameplayCueManager();
+	if (!CueManager)
+	{
+		return;
+	}
+
+	for (const FImpactCueEvent& Event : Events)
+	{
+		// Instigator ڱͻ˲ʱ豾 Pawn Ϊ Cue Ŀ꣨Burst  Cue ֻ Location
+		AActor* Target = Event.Instigator ? Event.Instigator.Get() : FallbackTarget;
+		if (!Target || !Event.CueTag.IsValid())
+		{
+			continue;
+		}
+
+		FGameplayCueParameters Params;
+		Params.Location = Event.Location;
+		Params.Normal = Event.Normal;
+		Params.RawMagnitude = Event.SurfaceType;
+		Params.Instigator = Event.Instigator;
+		Params.EffectCauser = Event.Instigator;
+
+		CueManager->HandleGameplayCue(Target, Event.CueTag, EGameplayCueEvent::Executed, Params);
+	}
+}
@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Engine/NetSerialization.h"
+#include "AG_ImpactCueSubsystem.generated.h"
+
+class AActionGamePlayerController;
+
+/**
+ * һб¼
+ * λ/ 1 ֽڣCue  Tag 
+ */
+USTRUCT()
+struct ACTIONGAME_API FImpactCueEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize Location;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal Normal;
+
+	/** EPhysicalSurface */
+	UPROPERTY()
+	uint8 SurfaceType = 0;
+
+	UPROPERTY()
+	FGameplayTag CueTag;
+
+	/** Cue Ŀ꣨ǹ/ߣͻ˲ʱΪ */
+	UPROPERTY()
+	TObjectPtr<AActor> Instigator = nullptr;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FImpactCueEvent> : public TStructOpsTypeTraitsBase2<FImpactCueEvent>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ *  Cue 
+ * Serverռһ֡ڵб¼üÿֻһδ RPC
+ * Client󽻸е GameplayCue ̣Executed
+ *
+ *  Cue Ĳ RawMagnitude ЯͣEPhysicalSurface
+ */
+UCLASS()
+class ACTIONGAME_API UAG_ImpactCueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** ãǼһб֣ag.ImpactCues.Batch 0 ʱ˻ص ExecuteGameplayCue */
+	void QueueImpactCue(const FGameplayTag& CueTag, const FHitResult& Hit, AActor* Instigator);
+
+	/** ִһ¼ͻ RPC / ң */
+	static void DispatchImpactCues(const TArray<FImpactCueEvent>& Events, AActor* FallbackTarget);
+
+	/** ӵüԼǱرõ */
+	static int32 GatherRelevantEvents(const TArray<FImpactCueEvent>& Events, const FVector& ViewLocation, const AActor* OwnPawn,
+		float RelevancyDistance, TArray<FImpactCueEvent>& OutBatch);
+
+	/** һӷ NumEvents ¼Ҫ RPC  */
+	static int32 GetNumRPCsForBatch(int32 NumEvents);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void FlushPendingEvents();
+	void SendToController(AActionGamePlayerController* PC, const TArray<FImpactCueEvent>& Batch);
+
+	TArray<FImpactCueEvent> PendingEvents;
+
+	/** Flush ʱãÿ֡ */
+	TArray<FImpactCueEvent> ScratchBatch;
+};
@@ -0,0 +1,280 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/AG_InteractPromptSubsystem.h"
+
+#include "ActionGame.h"
+#include "Blueprint/UserWidget.h"
+#include "DataAssets/WorldObjectDataAsset.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "UserWidget/WorldObjectPromptWidget.h"
+
+DECLARE_CYCLE_STAT(TEXT("Interact Prompt Update"), STAT_AG_InteractPromptUpdate, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interact Prompts Active"), STAT_AG_InteractPromptsActive, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interact Prompt Widgets"), STAT_AG_InteractPromptWidgets, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarPromptsMaxActive(
+	TEXT("ag.Prompts.MaxActive"),
+	4,
+	TEXT("Max number of interaction prompt widgets shown (and pooled) at once"),
+	ECVF_Default
+);
+
+bool UAG_InteractPromptSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UAG_InteractPromptSubsystem::Deinitialize()
+{
+	for (UWorldObjectPromptWidget* Widget : AllWidgets)
+	{
+		if (Widget)
+		{
+			Widget->RemoveFromParent();
+		}
+	}
+
+	AllWidgets.Reset();
+	FreeWidgets.Reset();
+	ActivePrompts.Reset();
+	Prompts.Reset();
+
+	SET_DWORD_STAT(STAT_AG_InteractPromptsActive, 0);
+	SET_DWORD_STAT(STAT_AG_InteractPromptWidgets, 0);
+
+	Super::Deinitialize();
+}
+
+void UAG_InteractPromptSubsystem::RegisterPrompt(AActor* Owner, UWorldObjectDataAsset* Data, TSubclassOf<UWorldObjectPromptWidget> WidgetClass, const FVector& Offset)
+{
+	if (!Owner)
+	{
+		return;
+	}
+
+	if (!WidgetClass)
+	{
+		WidgetClass = GetDefaultWidgetClass();
+	}
+	if (!WidgetClass)
+	{
+		bool bAlreadyWarned = false;
+		WarnedMissingWidgetClasses.Add(Owner->GetClass()->GetFName(), &bAlreadyWarned);
+		if (!bAlreadyWarned)
+		{
+			UE_LOG(LogActionGame, Warning,
+				TEXT("[%s] No prompt widget class and no DefaultWidgetClass in [/Script/ActionGame.AG_InteractPromptSubsystem]; prompts for this class are not shown"),
+				*Owner->GetClass()->GetName());
+		}
+		return;
+	}
+
+	FInteractPromptData& Prompt = Prompts.FindOrAdd(Owner);
+	Prompt.Data = Data;
+	Prompt.WidgetClass = WidgetClass;
+	Prompt.Offset = Offset;
+}
+
+TSubclassOf<UWorldObjectPromptWidget> UAG_InteractPromptSubsystem::GetDefaultWidgetClass()
+{
+	if (!bDefaultWidgetClassResolved)
+	{
+		bDefaultWidgetClassResolved = true;
+		LoadedDefaultWidgetClass = DefaultWidgetClass.LoadSynchronous();
+		if (!DefaultWidgetClass.IsNull() && !LoadedDefaultWidgetClass)
+		{
+			UE_LOG(LogActionGame, Warning, TEXT("DefaultWidgetClass %s could not be loaded as a UWorldObjectPromptWidget"),
+				*DefaultWidgetClass.ToString());
+		}
+	}
+	return LoadedDefaultWidgetClass;
+}
+
+void UAG_InteractPromptSubsystem::UnregisterPrompt(AActor* Owner)
+{
+	HidePrompt(Owner);
+	Prompts.Remove(Owner);
+}
+
+void UAG_InteractPromptSubsystem::SetPromptEnabled(AActor* Owner, bool bEnabled)
+{
+	if (FInteractPromptData* Prompt = Prompts.Find(Owner))
+	{
+		Prompt->bEnabled = bEnabled;
+		if (!bEnabled)
+		{
+			HidePrompt(Owner);
+		}
+	}
+}
+
+void UAG_InteractPromptSubsystem::SetPromptVisible(AActor* Owner, bool bVisible)
+{
+	if (!bVisible)
+	{
+		HidePrompt(Owner);
+		return;
+	}
+
+	const FInteractPromptData* Prompt = Prompts.Find(Owner);
+	if (!Prompt || !Prompt->bEnabled)
+	{
+		return;
+	}
+
+	const bool bAlreadyActive = ActivePrompts.ContainsByPredicate([Owner](const FActiveInteractPrompt& Active)
+	{
+		return Active.Owner.Get() == Owner;
+	});
+	if (bAlreadyActive)
+	{
+		return;
+	}
+
+	UWorldObjectPromptWidget* Widget = AcquireWidget(Prompt->WidgetClass);
+	if (!Widget)
+	{
+		return;
+	}
+
+	Widget->InitWithData(Prompt->Data.Get());
+
+	FActiveInteractPrompt& Active = ActivePrompts.AddDefaulted_GetRef();
+	Active.Owner = Owner;
+	Active.Widget = Widget;
+
+	SET_DWORD_STAT(STAT_AG_InteractPromptsActive, ActivePrompts.Num());
+}
+
+void UAG_InteractPromptSubsystem::HidePrompt(AActor* Owner)
+{
+	const int32 Index = ActivePrompts.IndexOfByPredicate([Owner](const FActiveInteractPrompt& Active)
+	{
+		return Active.Owner.Get() == Owner;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		ReleaseWidget(ActivePrompts[Index].Widget.Get());
+		ActivePrompts.RemoveAtSwap(Index);
+
+		SET_DWORD_STAT(STAT_AG_InteractPromptsActive, ActivePrompts.Num());
+	}
+}
+
+UWorldObjectPromptWidget* UAG_InteractPromptSubsystem::AcquireWidget(TSubclassOf<UWorldObjectPromptWidget> WidgetClass)
+{
+	// ȸͬĿ Widget
+	for (int32 Index = FreeWidgets.Num() - 1; Index >= 0; --Index)
+	{
+		UWorldObjectPromptWidget* Widget = FreeWidgets[Index];
+		if (Widget && Widget->GetClass() == WidgetClass)
+		{
+			FreeWidgets.RemoveAtSwap(Index);
+			return Widget;
+		}
+	}
+
+	if (ActivePrompts.Num() >= CVarPromptsMaxActive.GetValueOnGameThread())
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PC || !PC->IsLocalController())
+	{
+		return nullptr;
+	}
+
+	// һ͵Ŀ Widget
+	if (AllWidgets.Num() >= CVarPromptsMaxActive.GetValueOnGameThread() && FreeWidgets.Num() > 0)
+	{
+		UWorldObjectPromptWidget* Evicted = FreeWidgets.Pop();
+		AllWidgets.RemoveSingleSwap(Evicted);
+		Evicted->RemoveFromParent();
+	}
+
+	UWorldObjectPromptWidget* Widget = CreateWidget<UWorldObjectPromptWidget>(PC, WidgetClass);
+	if (!Widget)
+	{
+		return nullptr;
+	}
+
+	Widget->SetAlignmentInViewport(FVector2D(0.5f, 1.f));
+	Widget->AddToPlayerScreen();
+	AllWidgets.Add(Widget);
+
+	SET_DWORD_STAT(STAT_AG_InteractPromptWidgets, AllWidgets.Num());
+	return Widget;
+}
+
+void UAG_InteractPromptSubsystem::ReleaseWidget(UWorldObjectPromptWidget* Widget)
+{
+	if (!Widget)
+	{
+		return;
+	}
+
+	// Ƴӿڣֻ۵´ֱӸ
+	Widget->SetVisibility(ESlateVisibility::Collapsed);
+	FreeWidgets.Add(Widget);
+}
+
+void UAG_InteractPromptSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_AG_InteractPromptUpdate);
+
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+
+	for (int32 Index = ActivePrompts.Num() - 1; Index >= 0; --Index)
+	{
+		const FActiveInteractPrompt& Active = ActivePrompts[Index];
+		AActor* Owner = Active.Owner.Get();
+		UWorldObjectPromptWidget* Widget = Active.Widget.Get();
+
+		if (!Owner || !Widget)
+		{
+			ReleaseWidget(Widget);
+			ActivePrompts.RemoveAtSwap(Index);
+			continue;
+		}
+
+		const FInteractPromptData* Prompt = Prompts.Find(Owner);
+		const FVector WorldLocation = Owner->GetActorLocation() + (Prompt ? Prompt->Offset : FVector::ZeroVector);
+
+		FVector2D ScreenLocation;
+		if (PC && UGameplayStatics::ProjectWorldToScreen(PC, WorldLocation, ScreenLocation, true))
+		{
+			Widget->SetPositionInViewport(ScreenLocation, true);
+			Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+		}
+		else
+		{
+			// 
+			Widget->SetVisibility(ESlateVisibility::Collapsed);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AG_InteractPromptsActive, ActivePrompts.Num());
+}
+
+bool UAG_InteractPromptSubsystem::IsTickable() const
+{
+	return ActivePrompts.Num() > 0 && Super::IsTickable();
+}
+
+TStatId UAG_InteractPromptSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAG_InteractPromptSubsystem, STATGROUP_Tickables);
+}
+
+bool UAG_InteractPromptSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AG_InteractPromptSubsystem.generated.h"
+
+class UWorldObjectDataAsset;
+class UWorldObjectPromptWidget;
+
+/** ɽǼǵʾ */
+struct FInteractPromptData
+{
+	TWeakObjectPtr<UWorldObjectDataAsset> Data;
+
+	TSubclassOf<UWorldObjectPromptWidget> WidgetClass;
+
+	/**  Actor λõƫƣʾʾϷ */
+	FVector Offset = FVector::ZeroVector;
+
+	/** false ʱʾ籦Ѵ򿪣 */
+	bool bEnabled = true;
+};
+
+/** ʾʾ */
+struct FActiveInteractPrompt
+{
+	TWeakObjectPtr<AActor> Owner;
+
+	TWeakObjectPtr<UWorldObjectPromptWidget> Widget;
+};
+
+/**
+ * ʾͻˣ
+ * - ɽֻǼʾݣٸԴ WidgetComponent Tick 
+ * - ҵĽѡ仯ʱʾ / أĻռ Widget С︴ã ag.Prompts.MaxActive
+ * - ÿֻ֡ͶӰʾļʾ
+ * - ר÷Ҳᴴκ Widget
+ * - ɽû Widget ʱ DefaultWidgetClassDefaultGame.ini߶ûʱӡ
+ */
+UCLASS(Config = Game)
+class ACTIONGAME_API UAG_InteractPromptSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	/** WidgetClass Ϊʱʹ DefaultWidgetClass */
+	void RegisterPrompt(AActor* Owner, UWorldObjectDataAsset* Data, TSubclassOf<UWorldObjectPromptWidget> WidgetClass, const FVector& Offset);
+	void UnregisterPrompt(AActor* Owner);
+
+	/** ״̬仯򿪵ȣú */
+	void SetPromptEnabled(AActor* Owner, bool bEnabled);
+
+	/** ҽ / 뿪Χʱ */
+	void SetPromptVisible(AActor* Owner, bool bVisible);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UWorldObjectPromptWidget* AcquireWidget(TSubclassOf<UWorldObjectPromptWidget> WidgetClass);
+	void ReleaseWidget(UWorldObjectPromptWidget* Widget);
+
+	void HidePrompt(AActor* Owner);
+
+	/**  DefaultWidgetClassֻһΣ */
+	TSubclassOf<UWorldObjectPromptWidget> GetDefaultWidgetClass();
+
+	/** ɽûָ Widget ʱʹ */
+	UPROPERTY(Config)
+	TSoftClassPtr<UWorldObjectPromptWidget> DefaultWidgetClass;
+
+	UPROPERTY()
+	TSubclassOf<UWorldObjectPromptWidget> LoadedDefaultWidgetClass;
+
+	bool bDefaultWidgetClassResolved = false;
+
+	/** Ѿȱ Widget  Actor ࣬ÿֻһ */
+	TSet<FName> WarnedMissingWidgetClasses;
+
+	TMap<TWeakObjectPtr<AActor>, FInteractPromptData> Prompts;
+
+	TArray<FActiveInteractPrompt> ActivePrompts;
+
+	/** д Widgetã */
+	UPROPERTY()
+	TArray<TObjectPtr<UWorldObjectPromptWidget>> AllWidgets;
+
+	/**  Widget */
+	UPROPERTY()
+	TArray<TObjectPtr<UWorldObjectPromptWidget>> FreeWidgets;
+};
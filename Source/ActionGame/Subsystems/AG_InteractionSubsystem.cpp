@@ -0,0 +1,222 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/AG_InteractionSubsystem.h"
+
+#include "ActionGame.h"
+#include "AbilitySystem/Components/InteractableComponent.h"
+#include "ActorComponents/InteractCandidateComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+DECLARE_CYCLE_STAT(TEXT("Interact Candidate Update"), STAT_AG_InteractCandidateUpdate, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interactables Registered"), STAT_AG_InteractablesRegistered, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interactables Tested"), STAT_AG_InteractablesTested, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<float> CVarInteractUpdateRate(
+	TEXT("ag.Interact.UpdateRate"),
+	10.f,
+	TEXT("Interact candidate updates per second (<= 0 updates every frame)"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarInteractCellSize(
+	TEXT("ag.Interact.CellSize"),
+	500.f,
+	TEXT("Cell size of the interactable grid, read when the world starts"),
+	ECVF_Default
+);
+
+void UAG_InteractionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(50.f, CVarInteractCellSize.GetValueOnGameThread());
+}
+
+FIntPoint UAG_InteractionSubsystem::GetCellKey(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UAG_InteractionSubsystem::RegisterInteractable(UInteractableComponent* Interactable)
+{
+	if (!Interactable || Interactable->bRegisteredInGrid || !Interactable->GetOwner())
+	{
+		return;
+	}
+
+	AddToCell(Interactable);
+	MaxInteractRadius = FMath::Max(MaxInteractRadius, Interactable->GetInteractRadius());
+
+	INC_DWORD_STAT(STAT_AG_InteractablesRegistered);
+}
+
+void UAG_InteractionSubsystem::UnregisterInteractable(UInteractableComponent* Interactable)
+{
+	if (!Interactable || !Interactable->bRegisteredInGrid)
+	{
+		return;
+	}
+
+	RemoveFromCell(Interactable);
+
+	// кѡƳUI ȱֲõȵһθ
+	if (AActor* Owner = Interactable->GetOwner())
+	{
+		for (const TWeakObjectPtr<UInteractCandidateComponent>& WeakComp : CandidateComponents)
+		{
+			UInteractCandidateComponent* CandidateComp = WeakComp.Get();
+			if (CandidateComp && CandidateComp->IsInteractCandidate(Owner))
+			{
+				CandidateComp->RemoveCandidate(Owner);
+			}
+		}
+	}
+
+	DEC_DWORD_STAT(STAT_AG_InteractablesRegistered);
+}
+
+void UAG_InteractionSubsystem::UpdateInteractable(UInteractableComponent* Interactable)
+{
+	if (!Interactable || !Interactable->bRegisteredInGrid || !Interactable->GetOwner())
+	{
+		return;
+	}
+
+	const FIntPoint NewCell = GetCellKey(Interactable->GetOwner()->GetActorLocation());
+	if (NewCell != Interactable->GridCell)
+	{
+		RemoveFromCell(Interactable);
+		AddToCell(Interactable);
+	}
+}
+
+void UAG_InteractionSubsystem::AddToCell(UInteractableComponent* Interactable)
+{
+	const FIntPoint Cell = GetCellKey(Interactable->GetOwner()->GetActorLocation());
+	Cells.FindOrAdd(Cell).Add(Interactable);
+
+	Interactable->GridCell = Cell;
+	Interactable->bRegisteredInGrid = true;
+}
+
+void UAG_InteractionSubsystem::RemoveFromCell(UInteractableComponent* Interactable)
+{
+	if (TArray<TWeakObjectPtr<UInteractableComponent>>* CellItems = Cells.Find(Interactable->GridCell))
+	{
+		CellItems->RemoveSingleSwap(Interactable);
+		if (CellItems->Num() == 0)
+		{
+			Cells.Remove(Interactable->GridCell);
+		}
+	}
+
+	Interactable->bRegisteredInGrid = false;
+}
+
+void UAG_InteractionSubsystem::RegisterCandidateComponent(UInteractCandidateComponent* CandidateComp)
+{
+	if (CandidateComp)
+	{
+		CandidateComponents.AddUnique(CandidateComp);
+	}
+}
+
+void UAG_InteractionSubsystem::UnregisterCandidateComponent(UInteractCandidateComponent* CandidateComp)
+{
+	CandidateComponents.RemoveSingleSwap(CandidateComp);
+}
+
+void UAG_InteractionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const float UpdateRate = CVarInteractUpdateRate.GetValueOnGameThread();
+	TimeSinceUpdate += DeltaTime;
+	if (UpdateRate > 0.f && TimeSinceUpdate < 1.f / UpdateRate)
+	{
+		return;
+	}
+	TimeSinceUpdate = 0.f;
+
+	SCOPE_CYCLE_COUNTER(STAT_AG_InteractCandidateUpdate);
+
+	for (int32 Index = CandidateComponents.Num() - 1; Index >= 0; --Index)
+	{
+		UInteractCandidateComponent* CandidateComp = CandidateComponents[Index].Get();
+		if (!CandidateComp)
+		{
+			CandidateComponents.RemoveAtSwap(Index);
+			continue;
+		}
+
+		UpdateCandidates(CandidateComp);
+	}
+}
+
+void UAG_InteractionSubsystem::UpdateCandidates(UInteractCandidateComponent* CandidateComp)
+{
+	AActor* Owner = CandidateComp->GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	// УҪңͻֻıңģ
+	if (!Owner->HasAuthority())
+	{
+		const APawn* Pawn = Cast<APawn>(Owner);
+		if (!Pawn || !Pawn->IsLocallyControlled())
+		{
+			return;
+		}
+	}
+
+	const FVector Origin = Owner->GetActorLocation();
+	const FIntPoint MinCell = GetCellKey(Origin - FVector(MaxInteractRadius));
+	const FIntPoint MaxCell = GetCellKey(Origin + FVector(MaxInteractRadius));
+
+	ScratchInRange.Reset();
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<TWeakObjectPtr<UInteractableComponent>>* CellItems = Cells.Find(FIntPoint(X, Y));
+			if (!CellItems)
+			{
+				continue;
+			}
+
+			for (const TWeakObjectPtr<UInteractableComponent>& WeakInteractable : *CellItems)
+			{
+				const UInteractableComponent* Interactable = WeakInteractable.Get();
+				AActor* InteractableOwner = Interactable ? Interactable->GetOwner() : nullptr;
+				if (!InteractableOwner)
+				{
+					continue;
+				}
+
+				INC_DWORD_STAT(STAT_AG_InteractablesTested);
+
+				const float Radius = Interactable->GetInteractRadius();
+				if (FVector::DistSquared(Origin, InteractableOwner->GetActorLocation()) <= Radius * Radius)
+				{
+					ScratchInRange.Add(InteractableOwner);
+				}
+			}
+		}
+	}
+
+	CandidateComp->SetCandidates(ScratchInRange);
+}
+
+TStatId UAG_InteractionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAG_InteractionSubsystem, STATGROUP_Tickables);
+}
+
+bool UAG_InteractionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
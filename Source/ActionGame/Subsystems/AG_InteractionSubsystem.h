@@ -0,0 +1,67 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AG_InteractionSubsystem.generated.h"
+
+class UInteractableComponent;
+class UInteractCandidateComponent;
+
+/**
+ * ѡ
+ * - ɽעᵽ XY 񣨸ӱ߳ ag.Interact.CellSizeٸԴ Overlap 
+ * - ҵĺѡϰ̶Ƶʣag.Interact.UpdateRateһΰ뾶ѯֻб仯ʱŴ OnInteractCandidateChanged
+ * - ɽ UInteractableComponent ڸƶʱ UpdateInteractable ·ָ
+ * - ʱ UpdateCandidates 㣬У鲻һζʱ
+ * - ңͻֻ±ңUI ã
+ */
+UCLASS()
+class ACTIONGAME_API UAG_InteractionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	void RegisterInteractable(UInteractableComponent* Interactable);
+	void UnregisterInteractable(UInteractableComponent* Interactable);
+
+	/** ɽƶã·ָ */
+	void UpdateInteractable(UInteractableComponent* Interactable);
+
+	void RegisterCandidateComponent(UInteractCandidateComponent* CandidateComp);
+	void UnregisterCandidateComponent(UInteractCandidateComponent* CandidateComp);
+
+	/** һҵĺѡϣGA_Interact Уǰã */
+	void UpdateCandidates(UInteractCandidateComponent* CandidateComp);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FIntPoint GetCellKey(const FVector& Location) const;
+
+	void AddToCell(UInteractableComponent* Interactable);
+	void RemoveFromCell(UInteractableComponent* Interactable);
+
+	TMap<FIntPoint, TArray<TWeakObjectPtr<UInteractableComponent>>> Cells;
+
+	TArray<TWeakObjectPtr<UInteractCandidateComponent>> CandidateComponents;
+
+	/** עɽĽ뾶ѯǵĸӷΧ */
+	float MaxInteractRadius = 0.f;
+
+	/** World ʼʱȡ޸ CVar Ӱѽõ */
+	float CellSize = 500.f;
+
+	float TimeSinceUpdate = 0.f;
+
+	/** ÿβѯ */
+	TArray<AActor*> ScratchInRange;
+};
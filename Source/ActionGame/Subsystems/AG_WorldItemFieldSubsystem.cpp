@@ -0,0 +1,295 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/AG_WorldItemFieldSubsystem.h"
+
+#include "ActionGame.h"
+#include "Actors/WorldItemActor.h"
+#include "Actors/WorldItemFieldActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("World Item Promotion"), STAT_AG_WorldItemPromotion, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("World Items Resting"), STAT_AG_WorldItemsResting, STATGROUP_ActionGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("World Items Live Actors"), STAT_AG_WorldItemsLiveActors, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("World Items Promoted"), STAT_AG_WorldItemsPromoted, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("World Items Demoted"), STAT_AG_WorldItemsDemoted, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarWorldItemsField(
+	TEXT("ag.WorldItems.Field"),
+	1,
+	TEXT("1: resting loot lives in the instanced world item field, 0: every drop spawns an AWorldItemActor"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarWorldItemsPromoteRadius(
+	TEXT("ag.WorldItems.PromoteRadius"),
+	500.f,
+	TEXT("Players within this distance promote field items to full actors (keep above the interact radius)"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarWorldItemsUpdateRate(
+	TEXT("ag.WorldItems.UpdateRate"),
+	10.f,
+	TEXT("World item promotion checks per second (<= 0 checks every frame)"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarWorldItemsDemoteMargin(
+	TEXT("ag.WorldItems.DemoteMargin"),
+	300.f,
+	TEXT("Promoted items demote back to the field only beyond PromoteRadius + this distance from every player"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarWorldItemsDemoteDelay(
+	TEXT("ag.WorldItems.DemoteDelay"),
+	5.f,
+	TEXT("Seconds a promoted item must stay beyond the demote distance before it returns to the field"),
+	ECVF_Default
+);
+
+void UAG_WorldItemFieldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(100.f, CVarWorldItemsPromoteRadius.GetValueOnGameThread());
+}
+
+void UAG_WorldItemFieldSubsystem::Deinitialize()
+{
+	Cells.Reset();
+	NumItems = 0;
+	PromotedItems.Reset();
+	Field = nullptr;
+
+	SET_DWORD_STAT(STAT_AG_WorldItemsResting, 0);
+	SET_DWORD_STAT(STAT_AG_WorldItemsLiveActors, 0);
+
+	Super::Deinitialize();
+}
+
+FIntPoint UAG_WorldItemFieldSubsystem::GetCellKey(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UAG_WorldItemFieldSubsystem::SpawnItem(UDA_Item* ItemDef, const FVector& Location, TSubclassOf<AWorldItemActor> ActorClass, AActor* Owner)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client || !ItemDef || !ActorClass)
+	{
+		return;
+	}
+
+	if (!CVarWorldItemsField.GetValueOnGameThread() || !AddToField(ItemDef, Location, ActorClass, Owner))
+	{
+		SpawnItemActor(ItemDef, Location, ActorClass, Owner);
+	}
+}
+
+bool UAG_WorldItemFieldSubsystem::AddToField(UDA_Item* ItemDef, const FVector& Location, TSubclassOf<AWorldItemActor> ActorClass, AActor* Owner)
+{
+	AWorldItemFieldActor* FieldActor = GetOrSpawnField();
+	if (!FieldActor)
+	{
+		return false;
+	}
+
+	FGridItem GridItem;
+	GridItem.EntryId = FieldActor->AddItem(ItemDef, Location, ActorClass, Owner);
+	GridItem.Location = Location;
+
+	if (GridItem.EntryId == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Cells.FindOrAdd(GetCellKey(Location)).Add(GridItem);
+	++NumItems;
+
+	SET_DWORD_STAT(STAT_AG_WorldItemsResting, NumItems);
+	return true;
+}
+
+AWorldItemFieldActor* UAG_WorldItemFieldSubsystem::GetOrSpawnField()
+{
+	if (IsValid(Field))
+	{
+		return Field;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Params.ObjectFlags |= RF_Transient;
+
+	Field = GetWorld()->SpawnActor<AWorldItemFieldActor>(AWorldItemFieldActor::StaticClass(), FTransform::Identity, Params);
+	return Field;
+}
+
+AWorldItemActor* UAG_WorldItemFieldSubsystem::SpawnItemActor(UDA_Item* ItemDef, const FVector& Location, TSubclassOf<AWorldItemActor> ActorClass, AActor* Owner) const
+{
+	FActorSpawnParameters Params;
+	Params.Owner = Owner;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AWorldItemActor* ItemActor = GetWorld()->SpawnActor<AWorldItemActor>(ActorClass, Location, FRotator::ZeroRotator, Params);
+	if (ItemActor)
+	{
+		ItemActor->InitWithItemData(ItemDef);
+	}
+
+	return ItemActor;
+}
+
+void UAG_WorldItemFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const float UpdateRate = CVarWorldItemsUpdateRate.GetValueOnGameThread();
+	TimeSinceUpdate += DeltaTime;
+	if (UpdateRate > 0.f && TimeSinceUpdate < 1.f / UpdateRate)
+	{
+		return;
+	}
+	const float ElapsedTime = TimeSinceUpdate;
+	TimeSinceUpdate = 0.f;
+
+	SCOPE_CYCLE_COUNTER(STAT_AG_WorldItemPromotion);
+
+	const float Radius = CVarWorldItemsPromoteRadius.GetValueOnGameThread();
+
+	ScratchPawnLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		if (Pawn)
+		{
+			ScratchPawnLocations.Add(Pawn->GetActorLocation());
+			PromoteAround(Pawn->GetActorLocation(), Radius);
+		}
+	}
+
+	// һȦڱ߽總ʱᷴ /  Actor
+	if (CVarWorldItemsField.GetValueOnGameThread())
+	{
+		DemoteDistant(Radius + FMath::Max(0.f, CVarWorldItemsDemoteMargin.GetValueOnGameThread()), ElapsedTime);
+	}
+
+	SET_DWORD_STAT(STAT_AG_WorldItemsResting, NumItems);
+	SET_DWORD_STAT(STAT_AG_WorldItemsLiveActors, PromotedItems.Num());
+}
+
+void UAG_WorldItemFieldSubsystem::PromoteAround(const FVector& Origin, float Radius)
+{
+	const FIntPoint MinCell = GetCellKey(Origin - FVector(Radius));
+	const FIntPoint MaxCell = GetCellKey(Origin + FVector(Radius));
+
+	ScratchPromote.Reset();
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const FIntPoint CellKey(X, Y);
+			TArray<FGridItem>* CellItems = Cells.Find(CellKey);
+			if (!CellItems)
+			{
+				continue;
+			}
+
+			for (int32 Index = CellItems->Num() - 1; Index >= 0; --Index)
+			{
+				if (FVector::DistSquared((*CellItems)[Index].Location, Origin) <= Radius * Radius)
+				{
+					ScratchPromote.Add((*CellItems)[Index]);
+					CellItems->RemoveAtSwap(Index);
+				}
+			}
+
+			if (CellItems->Num() == 0)
+			{
+				Cells.Remove(CellKey);
+			}
+		}
+	}
+
+	//  Field ƳĿ Actor
+	for (const FGridItem& GridItem : ScratchPromote)
+	{
+		--NumItems;
+
+		FWorldItemFieldEntry Entry;
+		if (Field && Field->RemoveItem(GridItem.EntryId, Entry))
+		{
+			if (AWorldItemActor* ItemActor = SpawnItemActor(Entry.ItemDef, Entry.Location, Entry.ActorClass, Entry.SpawnOwner.Get()))
+			{
+				FPromotedItem& Promoted = PromotedItems.AddDefaulted_GetRef();
+				Promoted.Actor = ItemActor;
+			}
+			INC_DWORD_STAT(STAT_AG_WorldItemsPromoted);
+		}
+	}
+}
+
+void UAG_WorldItemFieldSubsystem::DemoteDistant(float DemoteRadius, float ElapsedTime)
+{
+	const float DemoteDelay = CVarWorldItemsDemoteDelay.GetValueOnGameThread();
+	const float DemoteRadiusSq = DemoteRadius * DemoteRadius;
+
+	for (int32 Index = PromotedItems.Num() - 1; Index >= 0; --Index)
+	{
+		FPromotedItem& Promoted = PromotedItems[Index];
+
+		// ѱʰȡ
+		AWorldItemActor* ItemActor = Promoted.Actor.Get();
+		if (!IsValid(ItemActor) || !ItemActor->GetItemDef())
+		{
+			PromotedItems.RemoveAtSwap(Index);
+			continue;
+		}
+
+		const FVector Location = ItemActor->GetActorLocation();
+		const bool bAnyPlayerNear = ScratchPawnLocations.ContainsByPredicate([&Location, DemoteRadiusSq](const FVector& PawnLocation)
+		{
+			return FVector::DistSquared(PawnLocation, Location) <= DemoteRadiusSq;
+		});
+
+		if (bAnyPlayerNear)
+		{
+			Promoted.TimeOutside = 0.f;
+			continue;
+		}
+
+		Promoted.TimeOutside += ElapsedTime;
+		if (Promoted.TimeOutside < DemoteDelay)
+		{
+			continue;
+		}
+
+		// д Field  Actorдʧܾͱ Actor
+		if (AddToField(ItemActor->GetItemDef(), Location, ItemActor->GetClass(), ItemActor->GetOwner()))
+		{
+			ItemActor->Destroy();
+			INC_DWORD_STAT(STAT_AG_WorldItemsDemoted);
+		}
+		PromotedItems.RemoveAtSwap(Index);
+	}
+}
+
+bool UAG_WorldItemFieldSubsystem::IsTickable() const
+{
+	return (NumItems > 0 || PromotedItems.Num() > 0) && Super::IsTickable();
+}
+
+TStatId UAG_WorldItemFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAG_WorldItemFieldSubsystem, STATGROUP_Tickables);
+}
+
+bool UAG_WorldItemFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AG_WorldItemFieldSubsystem.generated.h"
+
+class UDA_Item;
+class AWorldItemActor;
+class AWorldItemFieldActor;
+
+/**
+ * ϵ߼
+ * - Ϊ AWorldItemFieldActor еһ¼ڣ Actor
+ * - ̶Ƶʣag.WorldItems.UpdateRateΧѯ ag.WorldItems.PromoteRadius ĿΪ AWorldItemActor֮ԭн / ʰȡ
+ * -  Actor Ҷ PromoteRadius + ag.WorldItems.DemoteMargin  ag.WorldItems.DemoteDelay 󽵼 Field
+ *   ؾߣûнĻ Field ûã
+ * - ag.WorldItems.Field 0 ʱֱ ActorڶԱ
+ */
+UCLASS()
+class ACTIONGAME_API UAG_WorldItemFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**  Location һƷOwner Ϊ Actor  Owner */
+	void SpawnItem(UDA_Item* ItemDef, const FVector& Location, TSubclassOf<AWorldItemActor> ActorClass, AActor* Owner = nullptr);
+
+	/**  Field Ʒ */
+	int32 GetNumResting() const { return NumItems; }
+
+	/** ɱȻ Actor  */
+	int32 GetNumPromoted() const { return PromotedItems.Num(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FGridItem
+	{
+		int32 EntryId = INDEX_NONE;
+		FVector Location = FVector::ZeroVector;
+	};
+
+	/**  Actorڽ */
+	struct FPromotedItem
+	{
+		TWeakObjectPtr<AWorldItemActor> Actor;
+
+		/** Ҷۼʱ */
+		float TimeOutside = 0.f;
+	};
+
+	FIntPoint GetCellKey(const FVector& Location) const;
+
+	AWorldItemFieldActor* GetOrSpawnField();
+
+	/** Ž Field ʧܷ false */
+	bool AddToField(UDA_Item* ItemDef, const FVector& Location, TSubclassOf<AWorldItemActor> ActorClass, AActor* Owner);
+
+	AWorldItemActor* SpawnItemActor(UDA_Item* ItemDef, const FVector& Location, TSubclassOf<AWorldItemActor> ActorClass, AActor* Owner) const;
+
+	void PromoteAround(const FVector& Origin, float Radius);
+
+	void DemoteDistant(float DemoteRadius, float ElapsedTime);
+
+	UPROPERTY()
+	TObjectPtr<AWorldItemFieldActor> Field;
+
+	TMap<FIntPoint, TArray<FGridItem>> Cells;
+
+	int32 NumItems = 0;
+
+	/** World ʼʱȡ */
+	float CellSize = 500.f;
+
+	float TimeSinceUpdate = 0.f;
+
+	TArray<FPromotedItem> PromotedItems;
+
+	/** ÿβѯ */
+	TArray<FGridItem> ScratchPromote;
+	TArray<FVector> ScratchPawnLocations;
+};
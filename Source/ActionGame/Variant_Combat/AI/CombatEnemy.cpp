@@ -122,13 +122,14 @@ void ACombatEnemy::DoAttackTrace(FName DamageSourceBone)
 	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
 	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
 
-	// enemies only affect Pawn collision objects; they don't knock back boxes
+	// get the sweep radius and object types
+	float SweepRadius = 0.0f;
 	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	GetAttackSweepParams(SweepRadius, ObjectParams);
 
 	// use a sphere shape for the sweep
 	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
+	CollisionShape.SetSphere(SweepRadius);
 
 	// ignore self
 	FCollisionQueryParams QueryParams;
@@ -139,22 +140,36 @@ void ACombatEnemy::DoAttackTrace(FName DamageSourceBone)
 		// iterate over each object hit
 		for (const FHitResult& CurrentHit : OutHits)
 		{
-			/** does the actor have the player tag? */
-			if (CurrentHit.GetActor()->ActorHasTag(FName("Player")))
-			{
-				// check if the actor is damageable
-				ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
-
-				if (Damageable)
-				{
-					// knock upwards and away from the impact normal
-					const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
-
-					// pass the damage event to the actor
-					Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
-
-				}
-			}
+			ProcessAttackHit(CurrentHit);
+		}
+	}
+}
+
+void ACombatEnemy::GetAttackSweepParams(float& OutRadius, FCollisionObjectQueryParams& OutObjectParams) const
+{
+	OutRadius = MeleeTraceRadius;
+
+	// enemies only affect Pawn collision objects; they don't knock back boxes
+	OutObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+}
+
+void ACombatEnemy::ProcessAttackHit(const FHitResult& Hit)
+{
+	/** does the actor have the player tag? */
+	AActor* HitActor = Hit.GetActor();
+
+	if (HitActor && HitActor->ActorHasTag(FName("Player")))
+	{
+		// check if the actor is damageable
+		ICombatDamageable* Damageable = Cast<ICombatDamageable>(HitActor);
+
+		if (Damageable)
+		{
+			// knock upwards and away from the impact normal
+			const FVector Impulse = (Hit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+
+			// pass the damage event to the actor
+			Damageable->ApplyDamage(MeleeDamage, this, Hit.ImpactPoint, Impulse);
 		}
 	}
 }
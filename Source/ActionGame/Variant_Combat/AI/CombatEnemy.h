@@ -173,6 +173,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckChargedAttack() override;
 
+	/** Provides the melee sweep shape and object types */
+	virtual void GetAttackSweepParams(float& OutRadius, FCollisionObjectQueryParams& OutObjectParams) const override;
+
+	/** Deals melee damage and knockback to a single hit */
+	virtual void ProcessAttackHit(const FHitResult& Hit) override;
+
 	// ~end ICombatAttacker interface
 
 	// ~begin ICombatDamageable interface
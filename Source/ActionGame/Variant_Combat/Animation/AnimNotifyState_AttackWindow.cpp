@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "AnimNotifyState_AttackWindow.h"
+#include "CombatAttackWindowSubsystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+void UAnimNotifyState_AttackWindow::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+
+	// the subsystem only exists in game worlds, so editor previews are skipped
+	if (UCombatAttackWindowSubsystem* AttackWindows = MeshComp->GetWorld()->GetSubsystem<UCombatAttackWindowSubsystem>())
+	{
+		AttackWindows->OpenWindow(MeshComp, AttackBoneName, this);
+	}
+}
+
+void UAnimNotifyState_AttackWindow::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+
+	if (UCombatAttackWindowSubsystem* AttackWindows = MeshComp->GetWorld()->GetSubsystem<UCombatAttackWindowSubsystem>())
+	{
+		AttackWindows->CloseWindow(MeshComp, this);
+	}
+}
+
+FString UAnimNotifyState_AttackWindow::GetNotifyName_Implementation() const
+{
+	return FString("Attack Window");
+}
@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "AnimNotifyState_AttackWindow.generated.h"
+
+/**
+ *  AnimNotifyState that opens an attack window for its duration.
+ *  While open, the attack socket is swept every frame and each target is only hit once per swing.
+ */
+UCLASS()
+class UAnimNotifyState_AttackWindow : public UAnimNotifyState
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Source bone for the attack sweeps */
+	UPROPERTY(EditAnywhere, Category="Attack")
+	FName AttackBoneName;
+
+public:
+
+	/** Opens the attack window */
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+
+	/** Closes the attack window */
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+	/** Get the notify name */
+	virtual FString GetNotifyName_Implementation() const override;
+};
@@ -249,14 +249,14 @@ void ACombatCharacter::DoAttackTrace(FName DamageSourceBone)
 	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
 	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
 
-	// check for pawn and world dynamic collision object types
+	// get the sweep radius and object types
+	float SweepRadius = 0.0f;
 	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
-	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	GetAttackSweepParams(SweepRadius, ObjectParams);
 
 	// use a sphere shape for the sweep
 	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
+	CollisionShape.SetSphere(SweepRadius);
 
 	// ignore self
 	FCollisionQueryParams QueryParams;
@@ -267,21 +267,35 @@ void ACombatCharacter::DoAttackTrace(FName DamageSourceBone)
 		// iterate over each object hit
 		for (const FHitResult& CurrentHit : OutHits)
 		{
-			// check if we've hit a damageable actor
-			ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
+			ProcessAttackHit(CurrentHit);
+		}
+	}
+}
 
-			if (Damageable)
-			{
-				// knock upwards and away from the impact normal
-				const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+void ACombatCharacter::GetAttackSweepParams(float& OutRadius, FCollisionObjectQueryParams& OutObjectParams) const
+{
+	OutRadius = MeleeTraceRadius;
 
-				// pass the damage event to the actor
-				Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
+	// check for pawn and world dynamic collision object types
+	OutObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	OutObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+}
 
-				// call the BP handler to play effects, etc.
-				DealtDamage(MeleeDamage, CurrentHit.ImpactPoint);
-			}
-		}
+void ACombatCharacter::ProcessAttackHit(const FHitResult& Hit)
+{
+	// check if we've hit a damageable actor
+	ICombatDamageable* Damageable = Cast<ICombatDamageable>(Hit.GetActor());
+
+	if (Damageable)
+	{
+		// knock upwards and away from the impact normal
+		const FVector Impulse = (Hit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+
+		// pass the damage event to the actor
+		Damageable->ApplyDamage(MeleeDamage, this, Hit.ImpactPoint, Impulse);
+
+		// call the BP handler to play effects, etc.
+		DealtDamage(MeleeDamage, Hit.ImpactPoint);
 	}
 }
 
@@ -249,6 +249,12 @@ public:
 	/** Performs the charged attack hold check */
 	virtual void CheckChargedAttack() override;
 
+	/** Provides the melee sweep shape and object types */
+	virtual void GetAttackSweepParams(float& OutRadius, FCollisionObjectQueryParams& OutObjectParams) const override;
+
+	/** Deals melee damage and knockback to a single hit */
+	virtual void ProcessAttackHit(const FHitResult& Hit) override;
+
 	// ~end CombatAttacker interface
 
 	// ~begin CombatDamageable interface
@@ -0,0 +1,294 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatAttackWindowSubsystem.h"
+#include "CombatAttacker.h"
+#include "ActionGame.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Attack Windows Pass"), STAT_CombatAttackWindows, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attack Windows Active"), STAT_CombatAttackWindowsActive, STATGROUP_ActionGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attack Window Sweeps"), STAT_CombatAttackWindowSweeps, STATGROUP_ActionGame);
+
+static TAutoConsoleVariable<int32> CVarAttackWindowMaxSweepsPerFrame(
+	TEXT("Combat.AttackWindow.MaxSweepsPerFrame"),
+	64,
+	TEXT("Max number of sweeps all attack windows may perform in one frame. Every window gets at least one"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarAttackWindowMaxSubSteps(
+	TEXT("Combat.AttackWindow.MaxSubSteps"),
+	8,
+	TEXT("Max number of sub-steps a single attack window may perform in one frame"),
+	ECVF_Default
+);
+
+namespace CombatAttackWindow
+{
+	/** Fraction of the sweep radius the socket may travel per sub-step */
+	constexpr float StepSpacing = 1.0f;
+
+	/** Interpolates an actor space location around the actor's up axis so sub-steps follow the swing arc */
+	FVector InterpolateArc(const FVector& From, const FVector& To, float Alpha)
+	{
+		const float FromRadius = From.Size2D();
+		const float ToRadius = To.Size2D();
+
+		// too close to the pivot for a stable angle, fall back to a straight line
+		if (FromRadius < KINDA_SMALL_NUMBER || ToRadius < KINDA_SMALL_NUMBER)
+		{
+			return FMath::Lerp(From, To, Alpha);
+		}
+
+		const float FromYaw = FMath::Atan2(From.Y, From.X);
+		const float DeltaYaw = FMath::FindDeltaAngleRadians(FromYaw, FMath::Atan2(To.Y, To.X));
+
+		const float Yaw = FromYaw + DeltaYaw * Alpha;
+		const float Radius = FMath::Lerp(FromRadius, ToRadius, Alpha);
+
+		return FVector(Radius * FMath::Cos(Yaw), Radius * FMath::Sin(Yaw), FMath::Lerp(From.Z, To.Z, Alpha));
+	}
+
+	/** Approximate distance travelled along the arc */
+	float EstimateArcLength(const FVector& From, const FVector& To)
+	{
+		const float DeltaYaw = FMath::Abs(FMath::FindDeltaAngleRadians(FMath::Atan2(From.Y, From.X), FMath::Atan2(To.Y, To.X)));
+		const float Radius = FMath::Max(From.Size2D(), To.Size2D());
+
+		return DeltaYaw * Radius + FMath::Abs(To.Z - From.Z) + FMath::Abs(To.Size2D() - From.Size2D());
+	}
+}
+
+void UCombatAttackWindowSubsystem::OpenWindow(USkeletalMeshComponent* Mesh, FName BoneName, const UObject* Source)
+{
+	if (!Mesh || !Mesh->GetOwner())
+	{
+		return;
+	}
+
+	FCombatAttackWindow NewWindow;
+	NewWindow.Mesh = Mesh;
+	NewWindow.Source = Source;
+	NewWindow.BoneName = BoneName;
+	NewWindow.PrevActorTransform = Mesh->GetOwner()->GetActorTransform();
+	NewWindow.PrevLocalLocation = NewWindow.PrevActorTransform.InverseTransformPosition(Mesh->GetSocketLocation(BoneName));
+
+	// don't resize the window list while it's being iterated
+	if (bIsProcessing)
+	{
+		PendingWindows.Add(MoveTemp(NewWindow));
+		return;
+	}
+
+	// sweep the starting pose so targets already touching the weapon are hit
+	bIsProcessing = true;
+	SweepWindow(NewWindow, 1);
+	bIsProcessing = false;
+
+	Windows.Add(MoveTemp(NewWindow));
+	ApplyPendingChanges();
+}
+
+void UCombatAttackWindowSubsystem::CloseWindow(USkeletalMeshComponent* Mesh, const UObject* Source)
+{
+	for (int32 i = 0; i < Windows.Num(); ++i)
+	{
+		FCombatAttackWindow& Window = Windows[i];
+
+		if (Window.Mesh.Get() != Mesh || Window.Source.Get() != Source)
+		{
+			continue;
+		}
+
+		if (!bIsProcessing)
+		{
+			// catch up to the final pose before closing
+			bIsProcessing = true;
+			SweepWindow(Window, FMath::Clamp(GetDesiredSteps(Window), 1, CVarAttackWindowMaxSubSteps.GetValueOnGameThread()));
+			bIsProcessing = false;
+
+			Windows[i].bPendingClose = true;
+			ApplyPendingChanges();
+		}
+		else
+		{
+			// the running pass will finish and remove it
+			Window.bPendingClose = true;
+		}
+		return;
+	}
+
+	PendingWindows.RemoveAllSwap([Mesh, Source](const FCombatAttackWindow& Window)
+	{
+		return Window.Mesh.Get() == Mesh && Window.Source.Get() == Source;
+	});
+}
+
+void UCombatAttackWindowSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Windows.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_CombatAttackWindows);
+	INC_DWORD_STAT_BY(STAT_CombatAttackWindowsActive, Windows.Num());
+
+	const int32 MaxSubSteps = FMath::Max(1, CVarAttackWindowMaxSubSteps.GetValueOnGameThread());
+	const int32 Budget = FMath::Max(Windows.Num(), CVarAttackWindowMaxSweepsPerFrame.GetValueOnGameThread());
+
+	// gather the step count each window wants this frame
+	StepBuffer.SetNumUninitialized(Windows.Num());
+
+	int32 TotalSteps = 0;
+
+	for (int32 i = 0; i < Windows.Num(); ++i)
+	{
+		StepBuffer[i] = FMath::Clamp(GetDesiredSteps(Windows[i]), 1, MaxSubSteps);
+		TotalSteps += StepBuffer[i];
+	}
+
+	// scale everything down evenly if we're over budget
+	if (TotalSteps > Budget)
+	{
+		const float Scale = static_cast<float>(Budget) / TotalSteps;
+
+		for (int32& Steps : StepBuffer)
+		{
+			Steps = FMath::Max(1, FMath::FloorToInt(Steps * Scale));
+		}
+	}
+
+	// sweep all windows in one pass
+	bIsProcessing = true;
+
+	for (int32 i = 0; i < Windows.Num(); ++i)
+	{
+		if (!SweepWindow(Windows[i], StepBuffer[i]))
+		{
+			Windows[i].bPendingClose = true;
+		}
+	}
+
+	bIsProcessing = false;
+
+	ApplyPendingChanges();
+}
+
+void UCombatAttackWindowSubsystem::ApplyPendingChanges()
+{
+	// drop closed windows and merge any opened during a pass
+	Windows.RemoveAllSwap([](const FCombatAttackWindow& Window) { return Window.bPendingClose; });
+	Windows.Append(MoveTemp(PendingWindows));
+	PendingWindows.Reset();
+}
+
+TStatId UCombatAttackWindowSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatAttackWindowSubsystem, STATGROUP_Tickables);
+}
+
+bool UCombatAttackWindowSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 UCombatAttackWindowSubsystem::GetDesiredSteps(const FCombatAttackWindow& Window) const
+{
+	USkeletalMeshComponent* Mesh = Window.Mesh.Get();
+	AActor* Owner = Mesh ? Mesh->GetOwner() : nullptr;
+	ICombatAttacker* Attacker = Cast<ICombatAttacker>(Owner);
+
+	if (!Attacker)
+	{
+		return 1;
+	}
+
+	float SweepRadius = 0.0f;
+	FCollisionObjectQueryParams ObjectParams;
+	Attacker->GetAttackSweepParams(SweepRadius, ObjectParams);
+
+	const FTransform CurrentActorTransform = Owner->GetActorTransform();
+	const FVector CurrentLocal = CurrentActorTransform.InverseTransformPosition(Mesh->GetSocketLocation(Window.BoneName));
+
+	// arc travelled relative to the actor plus the actor's own movement
+	const float Distance = CombatAttackWindow::EstimateArcLength(Window.PrevLocalLocation, CurrentLocal)
+		+ FVector::Dist(Window.PrevActorTransform.GetLocation(), CurrentActorTransform.GetLocation());
+
+	const float StepLength = FMath::Max(SweepRadius * CombatAttackWindow::StepSpacing, 1.0f);
+
+	return FMath::Max(1, FMath::CeilToInt(Distance / StepLength));
+}
+
+bool UCombatAttackWindowSubsystem::SweepWindow(FCombatAttackWindow& Window, int32 NumSteps)
+{
+	USkeletalMeshComponent* Mesh = Window.Mesh.Get();
+	AActor* Owner = Mesh ? Mesh->GetOwner() : nullptr;
+	ICombatAttacker* Attacker = Cast<ICombatAttacker>(Owner);
+	UWorld* World = GetWorld();
+
+	if (!Attacker || !World)
+	{
+		return false;
+	}
+
+	float SweepRadius = 0.0f;
+	FCollisionObjectQueryParams ObjectParams;
+	Attacker->GetAttackSweepParams(SweepRadius, ObjectParams);
+
+	FCollisionShape CollisionShape;
+	CollisionShape.SetSphere(SweepRadius);
+
+	// ignore self
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(CombatAttackWindow), false, Owner);
+
+	const FTransform CurrentActorTransform = Owner->GetActorTransform();
+	const FVector CurrentLocal = CurrentActorTransform.InverseTransformPosition(Mesh->GetSocketLocation(Window.BoneName));
+
+	FVector StepStart = Window.PrevActorTransform.TransformPosition(Window.PrevLocalLocation);
+
+	for (int32 Step = 1; Step <= NumSteps; ++Step)
+	{
+		const float Alpha = static_cast<float>(Step) / NumSteps;
+
+		// blend the actor transform and the socket's arc around it
+		FTransform StepActorTransform;
+		StepActorTransform.Blend(Window.PrevActorTransform, CurrentActorTransform, Alpha);
+
+		const FVector StepEnd = StepActorTransform.TransformPosition(CombatAttackWindow::InterpolateArc(Window.PrevLocalLocation, CurrentLocal, Alpha));
+
+		HitBuffer.Reset();
+		World->SweepMultiByObjectType(HitBuffer, StepStart, StepEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams);
+		INC_DWORD_STAT(STAT_CombatAttackWindowSweeps);
+
+		for (const FHitResult& CurrentHit : HitBuffer)
+		{
+			AActor* HitActor = CurrentHit.GetActor();
+
+			if (!HitActor)
+			{
+				continue;
+			}
+
+			// only hit each actor once per swing
+			bool bAlreadyHit = false;
+			Window.HitActors.Add(HitActor, &bAlreadyHit);
+
+			if (!bAlreadyHit)
+			{
+				Attacker->ProcessAttackHit(CurrentHit);
+			}
+		}
+
+		StepStart = StepEnd;
+	}
+
+	Window.PrevActorTransform = CurrentActorTransform;
+	Window.PrevLocalLocation = CurrentLocal;
+
+	return true;
+}
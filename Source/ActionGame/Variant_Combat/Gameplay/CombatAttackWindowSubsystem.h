@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatAttackWindowSubsystem.generated.h"
+
+class USkeletalMeshComponent;
+
+/**
+ *  A single open attack window.
+ *  Tracks the attack socket between frames and remembers every actor hit during the swing.
+ */
+struct FCombatAttackWindow
+{
+	/** Mesh playing the attack animation */
+	TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+
+	/** Object that opened the window, used to match open and close calls */
+	TWeakObjectPtr<const UObject> Source;
+
+	/** Socket or bone the sweeps follow */
+	FName BoneName;
+
+	/** Socket location in actor space at the end of the last processed step */
+	FVector PrevLocalLocation = FVector::ZeroVector;
+
+	/** Actor transform at the end of the last processed step */
+	FTransform PrevActorTransform;
+
+	/** Actors already hit during this swing */
+	TSet<TWeakObjectPtr<AActor>> HitActors;
+
+	/** Set when the window was closed while the batched pass was running */
+	bool bPendingClose = false;
+};
+
+/**
+ *  Processes all melee attack windows in one batched pass per frame.
+ *  Each window sub-steps sphere sweeps along the arc between the previous and current socket transforms,
+ *  with the number of steps adapted to how far the socket moved and bounded by a per-frame budget.
+ *  A target is only damaged once per window.
+ */
+UCLASS()
+class UCombatAttackWindowSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Opens an attack window for the given mesh and socket */
+	void OpenWindow(USkeletalMeshComponent* Mesh, FName BoneName, const UObject* Source);
+
+	/** Processes any remaining movement and closes the matching attack window */
+	void CloseWindow(USkeletalMeshComponent* Mesh, const UObject* Source);
+
+	// ~begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end FTickableGameObject interface
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Estimates how many sub-steps a window needs to cover its socket movement this frame */
+	int32 GetDesiredSteps(const FCombatAttackWindow& Window) const;
+
+	/** Sweeps a window up to the current pose. Returns false if the window is no longer valid */
+	bool SweepWindow(FCombatAttackWindow& Window, int32 NumSteps);
+
+	/** Removes closed windows and adds windows opened while a pass was running */
+	void ApplyPendingChanges();
+
+	/** Currently open windows */
+	TArray<FCombatAttackWindow> Windows;
+
+	/** Windows opened while the batched pass was running. Merged in after the pass */
+	TArray<FCombatAttackWindow> PendingWindows;
+
+	/** True while the batched pass is iterating the windows */
+	bool bIsProcessing = false;
+
+	/** Scratch buffers reused by the batched pass */
+	TArray<int32> StepBuffer;
+	TArray<FHitResult> HitBuffer;
+};
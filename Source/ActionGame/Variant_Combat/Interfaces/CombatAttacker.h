@@ -6,6 +6,9 @@
 #include "UObject/Interface.h"
 #include "CombatAttacker.generated.h"
 
+struct FHitResult;
+struct FCollisionObjectQueryParams;
+
 /**
  *  CombatAttacker Interface
  *  Provides common functionality to trigger attack animation events.
@@ -33,4 +36,10 @@ public:
 	/** Performs a charged attack's check to loop the charge animation. Usually called from a montage's AnimNotify */
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckChargedAttack() = 0;
+
+	/** Provides the sweep radius and object types used by attack traces and attack windows */
+	virtual void GetAttackSweepParams(float& OutRadius, FCollisionObjectQueryParams& OutObjectParams) const = 0;
+
+	/** Handles a single attack hit. Attack windows call this at most once per target per swing */
+	virtual void ProcessAttackHit(const FHitResult& Hit) = 0;
 };
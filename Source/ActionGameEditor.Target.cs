@@ -11,5 +11,6 @@ public class ActionGameEditorTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_6;
 		ExtraModuleNames.Add("ActionGame");
+		ExtraModuleNames.Add("ActionGameTests");
 	}
 }
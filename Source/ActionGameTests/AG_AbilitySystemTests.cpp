@@ -0,0 +1,262 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystem/AG_GameplayEffectContext.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+#include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
+#include "Characters/EnemyGroundShooterCharacter.h"
+#include "DataAssets/DA_Item.h"
+#include "AG_TestAbilities.h"
+#include "AG_TestEffects.h"
+#include "AG_TestNet.h"
+
+/**
+ * Spec ģ建
+ * - ÿηضһ÷д SetByCaller һ÷ Spec 
+ * - ģյԴԱ˲ʱ޸ģSetNumericAttributeBaseһȡֵ
+ * - ÿμύȴ GEЧģϣμõͬһģ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGCachedSpecTest, "ActionGame.AbilitySystem.CachedOutgoingSpec",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGCachedSpecTest::RunTest(const FString& Parameters)
+{
+	FAGTestWorld TestWorld;
+
+	AEnemyCharacterBase* Enemy = TestWorld.Spawn<AEnemyGroundShooterCharacter>(FVector(0.f, 0.f, 100.f));
+	UAbilitySystemComponent* ASC = Enemy ? Enemy->GetAbilitySystemComponent() : nullptr;
+	if (!TestNotNull(TEXT("Enemy ASC"), Cast<UAG_AbilitySystemComponentBase>(ASC)))
+	{
+		return false;
+	}
+
+	const TSubclassOf<UGameplayEffect> EffectClass = UAG_TestEffect_SourceScaledDamage::StaticClass();
+	ASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetAttackPowerAttribute(), 10.f);
+
+	// һ÷д SetByCaller
+	FGameplayEffectSpecHandle First = UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(ASC, EffectClass, 1.f, ASC->MakeEffectContext());
+	if (!TestTrue(TEXT("First spec valid"), First.IsValid()))
+	{
+		return false;
+	}
+	First.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Damage, 50.f);
+
+	// ڶ÷õ Spec Ӧ
+	FGameplayEffectSpecHandle Second = UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(ASC, EffectClass, 1.f, ASC->MakeEffectContext());
+	TestTrue(TEXT("Cached specs are distinct copies"), First.Data.Get() != Second.Data.Get());
+	TestEqual(TEXT("SetByCaller does not leak between callers"),
+		Second.Data->GetSetByCallerMagnitude(AGGameplayTags::Data_Damage, false, -1.f), -1.f);
+
+	Second.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Damage, 0.f);
+	Second.Data->CalculateModifierMagnitudes();
+	TestEqual(TEXT("Captured AttackPower before change"), Second.Data->GetModifierMagnitude(0, false), -10.f);
+
+	//  GE ޸ҲҪģ
+	ASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetAttackPowerAttribute(), 25.f);
+
+	FGameplayEffectSpecHandle Third = UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(ASC, EffectClass, 1.f, ASC->MakeEffectContext());
+	Third.Data->SetSetByCallerMagnitude(AGGameplayTags::Data_Damage, 0.f);
+	Third.Data->CalculateModifierMagnitudes();
+	TestEqual(TEXT("Captured AttackPower after SetNumericAttributeBase"), Third.Data->GetModifierMagnitude(0, false), -25.f);
+
+	// μύһȴ GEЧģ
+	UAG_AbilitySystemComponentBase* AGASC = CastChecked<UAG_AbilitySystemComponentBase>(ASC);
+	const FGameplayEffectSpec* Template = AGASC->FindSpecTemplate(EffectClass, 1.f);
+	if (!TestNotNull(TEXT("Template cached"), Template))
+	{
+		return false;
+	}
+
+	const FGameplayAbilitySpecHandle AbilityHandle = ASC->GiveAbility(FGameplayAbilitySpec(UAG_TestAbility_CooldownAttack::StaticClass(), 1));
+	FGameplayEffectQuery CooldownQuery;
+	CooldownQuery.EffectDefinition = UAG_TestEffect_Cooldown::StaticClass();
+
+	for (int32 Activation = 1; Activation <= 2; ++Activation)
+	{
+		TestTrue(*FString::Printf(TEXT("Activation %d"), Activation), ASC->TryActivateAbility(AbilityHandle));
+		TestEqual(*FString::Printf(TEXT("Cooldown GE applied by activation %d"), Activation), ASC->GetActiveEffects(CooldownQuery).Num(), Activation);
+		TestTrue(*FString::Printf(TEXT("Template reused after activation %d"), Activation), AGASC->FindSpecTemplate(EffectClass, 1.f) == Template);
+	}
+
+	// ȴƳҲ
+	ASC->RemoveActiveEffects(CooldownQuery);
+	TestTrue(TEXT("Template reused after the cooldown is removed"), AGASC->FindSpecTemplate(EffectClass, 1.f) == Template);
+
+	return true;
+}
+
+/**
+ * Ʒ GE ӳ
+ * - ȡ Data.Item.Stack ľʽ GE ÿƷһεЧ GE ÿƷһʵ˲ʱ GE ÿƷӦһΣ
+ * - ȡ Data.Item.Stack  GE ֻһʵ仯ԭظ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGItemEffectStacksTest, "ActionGame.AbilitySystem.ItemEffectStacks",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGItemEffectStacksTest::RunTest(const FString& Parameters)
+{
+	FAGTestWorld TestWorld;
+
+	AEnemyCharacterBase* Enemy = TestWorld.Spawn<AEnemyGroundShooterCharacter>(FVector(0.f, 0.f, 100.f));
+	UAG_AbilitySystemComponentBase* ASC = Enemy ? Cast<UAG_AbilitySystemComponentBase>(Enemy->GetAbilitySystemComponent()) : nullptr;
+	if (!TestNotNull(TEXT("Enemy ASC"), ASC))
+	{
+		return false;
+	}
+
+	const FGameplayAttribute FlatAttribute = UAG_EnemyAttributeSet::GetAttackPowerAttribute();
+	const FGameplayAttribute ScaledAttribute = UAG_EnemyAttributeSet::GetAttackMultiplierAttribute();
+	const FGameplayAttribute InstantAttribute = UAG_EnemyAttributeSet::GetBountyGoldAttribute();
+	ASC->SetNumericAttributeBase(FlatAttribute, 0.f);
+	ASC->SetNumericAttributeBase(ScaledAttribute, 0.f);
+	ASC->SetNumericAttributeBase(InstantAttribute, 0.f);
+
+	UDA_Item* Item = NewObject<UDA_Item>(GetTransientPackage());
+	Item->GrantedEffects.Add(UAG_TestEffect_ItemFlat::StaticClass());
+	Item->GrantedEffects.Add(UAG_TestEffect_ItemScaled::StaticClass());
+	Item->GrantedEffects.Add(UAG_TestEffect_ItemInstant::StaticClass());
+
+	auto CountActive = [ASC](TSubclassOf<UGameplayEffect> EffectClass)
+	{
+		FGameplayEffectQuery Query;
+		Query.EffectDefinition = EffectClass;
+		return ASC->GetActiveEffects(Query).Num();
+	};
+
+	ASC->ApplyItem(Item, 0, 3);
+	TestEqual(TEXT("Flat GE: one instance per item"), CountActive(UAG_TestEffect_ItemFlat::StaticClass()), 3);
+	TestEqual(TEXT("Flat GE: +1 per item"), ASC->GetNumericAttribute(FlatAttribute), 3.f);
+	TestEqual(TEXT("Scaled GE: single instance"), CountActive(UAG_TestEffect_ItemScaled::StaticClass()), 1);
+	TestEqual(TEXT("Scaled GE: reads the stack count"), ASC->GetNumericAttribute(ScaledAttribute), 3.f);
+	TestEqual(TEXT("Instant GE: applied once per item"), ASC->GetNumericAttribute(InstantAttribute), 3.f);
+
+	ASC->ApplyItem(Item, 3, 5);
+	TestEqual(TEXT("Flat GE after 3 -> 5"), ASC->GetNumericAttribute(FlatAttribute), 5.f);
+	TestEqual(TEXT("Scaled GE updated in place"), CountActive(UAG_TestEffect_ItemScaled::StaticClass()), 1);
+	TestEqual(TEXT("Scaled GE after 3 -> 5"), ASC->GetNumericAttribute(ScaledAttribute), 5.f);
+	TestEqual(TEXT("Instant GE after 3 -> 5"), ASC->GetNumericAttribute(InstantAttribute), 5.f);
+
+	ASC->ApplyItem(Item, 5, 2);
+	TestEqual(TEXT("Flat GE after 5 -> 2"), CountActive(UAG_TestEffect_ItemFlat::StaticClass()), 2);
+	TestEqual(TEXT("Scaled GE after 5 -> 2"), ASC->GetNumericAttribute(ScaledAttribute), 2.f);
+	TestEqual(TEXT("Instant GE is not refunded"), ASC->GetNumericAttribute(InstantAttribute), 5.f);
+
+	ASC->RemoveItem(Item);
+	TestEqual(TEXT("Flat GE removed"), ASC->GetNumericAttribute(FlatAttribute), 0.f);
+	TestEqual(TEXT("Scaled GE removed"), ASC->GetNumericAttribute(ScaledAttribute), 0.f);
+
+	return true;
+}
+
+namespace AGEffectContextTests
+{
+	/** ǰ ag.EffectContext.Compact дһΣλOut Ϊص Context */
+	int64 RoundTrip(const FAGGameplayEffectContext& Source, UPackageMap* Map, FAGGameplayEffectContext& Out, bool& bOutSuccess)
+	{
+		FAGGameplayEffectContext Sending = Source;
+		FNetBitWriter Writer(Map, 8192);
+		bool bWriteOk = true;
+		Sending.NetSerialize(Writer, Map, bWriteOk);
+
+		FNetBitReader Reader(Map, Writer.GetData(), Writer.GetNumBits());
+		bool bReadOk = true;
+		Out.NetSerialize(Reader, Map, bReadOk);
+
+		bOutSuccess = bWriteOk && bReadOk && !Writer.IsError() && !Reader.IsError();
+		return Writer.GetNumBits();
+	}
+}
+
+/**
+ * EffectContext ֽѹʽĬϸʽдһͬһе Context
+ * - ð packed int 루UAG_TestPackageMapĬϸʽ Actor / Component 
+ * - ָʽغ Instigator 
+ * - ѹʽغе /  /  / ͱActor / Component / PhysMaterial Ϊ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGEffectContextBytesTest, "ActionGame.AbilitySystem.EffectContextBytes",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGEffectContextBytesTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* CompactCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ag.EffectContext.Compact"));
+	if (!TestNotNull(TEXT("ag.EffectContext.Compact"), CompactCVar))
+	{
+		return false;
+	}
+	const int32 PrevCompact = CompactCVar->GetInt();
+
+	FAGTestWorld TestWorld;
+	AActor* Instigator = TestWorld.Spawn<AEnemyGroundShooterCharacter>(FVector(0.f, 0.f, 100.f));
+	AActor* HitActor = TestWorld.Spawn<AEnemyGroundShooterCharacter>(FVector(1300.f, 0.f, 100.f));
+	if (!TestNotNull(TEXT("Instigator"), Instigator) || !TestNotNull(TEXT("Hit actor"), HitActor))
+	{
+		return false;
+	}
+
+	UPackageMap* Map = NewObject<UAG_TestPackageMap>();
+
+	FHitResult Hit(HitActor, Cast<UPrimitiveComponent>(HitActor->GetRootComponent()), FVector(1250.f, -12.25f, 96.5f), FVector(-0.8f, 0.6f, 0.f));
+	Hit.bBlockingHit = true;
+	Hit.TraceStart = FVector(0.f, 0.f, 100.f);
+	Hit.TraceEnd = FVector(2000.f, 0.f, 100.f);
+	Hit.Location = FVector(1234.5f, -12.25f, 100.f);
+	Hit.ImpactPoint = FVector(1250.f, -12.25f, 96.5f);
+	Hit.Normal = FVector(-1.f, 0.f, 0.f);
+	Hit.ImpactNormal = FVector(-0.8f, 0.6f, 0.f);
+	Hit.Distance = 1234.5f;
+	Hit.Time = Hit.Distance / 2000.f;
+	Hit.BoneName = TEXT("spine_03");
+	Hit.FaceIndex = 7;
+
+	FAGGameplayEffectContext Source;
+	Source.AddInstigator(Instigator, Instigator);
+	Source.AddHitResult(Hit);
+	Source.AddOrigin(FVector(10.f, 20.f, 30.f));
+	Source.SetDamageArchetype(EAGDamageArchetype::EnemyProjectile);
+
+	FAGGameplayEffectContext CompactOut;
+	FAGGameplayEffectContext FullOut;
+	bool bCompactOk = false;
+	bool bFullOk = false;
+
+	CompactCVar->Set(1, ECVF_SetByCode);
+	const int64 CompactBits = AGEffectContextTests::RoundTrip(Source, Map, CompactOut, bCompactOk);
+	CompactCVar->Set(0, ECVF_SetByCode);
+	const int64 FullBits = AGEffectContextTests::RoundTrip(Source, Map, FullOut, bFullOk);
+	CompactCVar->Set(PrevCompact, ECVF_SetByCode);
+
+	TestTrue(TEXT("Compact round trip succeeds"), bCompactOk);
+	TestTrue(TEXT("Full round trip succeeds"), bFullOk);
+
+	AddInfo(FString::Printf(TEXT("Effect context with hit: compact %lld bits (%lld bytes), full %lld bits (%lld bytes), saved %.0f%%"),
+		CompactBits, (CompactBits + 7) / 8, FullBits, (FullBits + 7) / 8,
+		FullBits > 0 ? 100.0 * (FullBits - CompactBits) / FullBits : 0.0));
+	TestTrue(TEXT("Compact format is smaller than the engine format"), CompactBits < FullBits);
+
+	const FHitResult* CompactHit = CompactOut.GetHitResult();
+	if (TestNotNull(TEXT("Compact context rebuilds a hit result"), CompactHit))
+	{
+		TestTrue(TEXT("Impact point survives quantization"), CompactHit->ImpactPoint.Equals(Hit.ImpactPoint, 1.f));
+		TestTrue(TEXT("Impact normal survives quantization"), CompactHit->ImpactNormal.Equals(Hit.ImpactNormal.GetSafeNormal(), 0.01f));
+		TestNull(TEXT("Rebuilt hit has no actor"), CompactHit->GetActor());
+		TestNull(TEXT("Rebuilt hit has no component"), CompactHit->GetComponent());
+		TestFalse(TEXT("Rebuilt hit has no physical material"), CompactHit->PhysMaterial.IsValid());
+		TestTrue(TEXT("Rebuilt hit has no bone"), CompactHit->BoneName.IsNone());
+	}
+	TestTrue(TEXT("Surface type survives"), CompactOut.GetSurfaceType() == Source.GetSurfaceType());
+	TestTrue(TEXT("Compact archetype survives"), CompactOut.GetDamageArchetype() == EAGDamageArchetype::EnemyProjectile);
+	TestTrue(TEXT("Full archetype survives"), FullOut.GetDamageArchetype() == EAGDamageArchetype::EnemyProjectile);
+	TestTrue(TEXT("World origin survives"), CompactOut.GetOrigin().Equals(Source.GetOrigin(), 1.f));
+	TestTrue(TEXT("Compact instigator survives"), CompactOut.GetInstigator() == Instigator);
+	TestTrue(TEXT("Full instigator survives"), FullOut.GetInstigator() == Instigator);
+	TestTrue(TEXT("Full hit keeps the actor"), FullOut.GetHitResult() && FullOut.GetHitResult()->GetActor() == HitActor);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "AbilitySystemComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystem/Abilities/GA_Interact.h"
+#include "AbilitySystem/Abilities/GA_SecondAttack.h"
+#include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
+#include "AG_TestActors.h"
+#include "AG_TestEffects.h"
+
+/**
+ *  ASC  PlayerState ϣ¼
+ * - 100  Pawn + Possessʼͬһ ASCAbility Spec  Effect ǵһǷ
+ * - ÿ˲ʱʼ GE ִУѪһȴ GE  State.Dead 
+ * - ͬһ Pawn 100  UnPossess / Possessʲô裬ʼ GE Ҳִ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGCharacterRespawnGrantsTest, "ActionGame.Character.RespawnGrants",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGCharacterRespawnGrantsTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumRespawns = 100;
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	APlayerController* Controller = World->SpawnActor<APlayerController>();
+	AActionGamePlayerState* PlayerState = AGTest::GivePlayerState(Controller);
+	UAbilitySystemComponent* ASC = PlayerState ? PlayerState->GetAbilitySystemComponent() : nullptr;
+	if (!TestNotNull(TEXT("Player controller"), Controller) || !TestNotNull(TEXT("PlayerState ASC"), ASC))
+	{
+		return false;
+	}
+
+	FCharacterData CharacterData;
+	CharacterData.Abilities = { UGA_Interact::StaticClass(), UGA_SecondAttack::StaticClass() };
+	CharacterData.Effects = { UAG_TestEffect_Startup::StaticClass(), UAG_TestEffect_PlayerInit::StaticClass() };
+
+	int32 InitApplications = 0;
+	const FDelegateHandle AppliedHandle = ASC->OnGameplayEffectAppliedDelegateToSelf.AddLambda(
+		[&InitApplications](UAbilitySystemComponent*, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle)
+		{
+			if (Spec.Def && Spec.Def->IsA<UAG_TestEffect_PlayerInit>())
+			{
+				++InitApplications;
+			}
+		});
+
+	auto SpawnAndPossess = [&]()
+	{
+		AAG_TestPlayerCharacter* Character = TestWorld.Spawn<AAG_TestPlayerCharacter>(FVector(0.f, 0.f, 100.f));
+		if (Character)
+		{
+			Character->SetCharacterData(CharacterData);
+			Controller->Possess(Character);
+		}
+		return Character;
+	};
+
+	auto GetSpecHandles = [ASC]()
+	{
+		TSet<FGameplayAbilitySpecHandle> Handles;
+		for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+		{
+			Handles.Add(Spec.Handle);
+		}
+		return Handles;
+	};
+
+	AAG_TestPlayerCharacter* Character = SpawnAndPossess();
+	if (!TestNotNull(TEXT("First character"), Character))
+	{
+		return false;
+	}
+
+	const TSet<FGameplayAbilitySpecHandle> FirstSpecs = GetSpecHandles();
+	const TArray<FActiveGameplayEffectHandle> FirstEffects = ASC->GetActiveEffects(FGameplayEffectQuery());
+	TestEqual(TEXT("Ability specs granted once"), FirstSpecs.Num(), CharacterData.Abilities.Num());
+	TestEqual(TEXT("Only the infinite startup effect stays active"), FirstEffects.Num(), 1);
+	TestEqual(TEXT("Init effect applied on first possession"), InitApplications, 1);
+
+	// 1) ÿζ Pawnһ˺ȴ Tag
+	bool bSameASC = true;
+	bool bSpecsKept = true;
+	bool bEffectsKept = true;
+	bool bLifeReset = true;
+	for (int32 Respawn = 0; Respawn < NumRespawns; ++Respawn)
+	{
+		ASC->SetNumericAttributeBase(UAG_AttributeSetBase::GetHealthAttribute(), 10.f);
+		ASC->ApplyGameplayEffectToSelf(GetDefault<UAG_TestEffect_Cooldown>(), 1.f, ASC->MakeEffectContext());
+		ASC->AddLooseGameplayTag(AGGameplayTags::State_Dead);
+
+		Controller->UnPossess();
+		Character->Destroy();
+		TestWorld.Tick();
+
+		Character = SpawnAndPossess();
+		if (!TestNotNull(TEXT("Respawned character"), Character))
+		{
+			return false;
+		}
+
+		bSameASC &= Character->GetAbilitySystemComponent() == ASC;
+		bSpecsKept &= GetSpecHandles().Num() == FirstSpecs.Num() && GetSpecHandles().Includes(FirstSpecs);
+		bEffectsKept &= ASC->GetActiveEffects(FGameplayEffectQuery()) == FirstEffects;
+		bLifeReset &= !ASC->HasMatchingGameplayTag(AGGameplayTags::State_Dead)
+			&& FMath::IsNearlyEqual(ASC->GetNumericAttribute(UAG_AttributeSetBase::GetHealthAttribute()), 100.f);
+	}
+
+	TestTrue(TEXT("Every respawned pawn uses the PlayerState's ASC"), bSameASC);
+	TestTrue(TEXT("Ability spec handles survive respawn"), bSpecsKept);
+	TestTrue(TEXT("Startup effect handle survives, last life's cooldown is removed"), bEffectsKept);
+	TestTrue(TEXT("State.Dead cleared and health re-initialized on respawn"), bLifeReset);
+	TestEqual(TEXT("Init effect applied once per life"), InitApplications, 1 + NumRespawns);
+
+	// 2) ͬһ Pawn ظ Possess Avatarʲôִ
+	for (int32 Repossess = 0; Repossess < NumRespawns; ++Repossess)
+	{
+		Controller->UnPossess();
+		Controller->Possess(Character);
+	}
+
+	TestTrue(TEXT("Ability spec handles kept after re-possessing"), GetSpecHandles().Num() == FirstSpecs.Num() && GetSpecHandles().Includes(FirstSpecs));
+	TestTrue(TEXT("Startup effect handle kept after re-possessing"), ASC->GetActiveEffects(FGameplayEffectQuery()) == FirstEffects);
+	TestEqual(TEXT("Init effect not re-applied when re-possessing the same pawn"), InitApplications, 1 + NumRespawns);
+
+	ASC->OnGameplayEffectAppliedDelegateToSelf.Remove(AppliedHandle);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
+#include "Subsystems/AG_DamageAccumulatorSubsystem.h"
+#include "AG_TestActors.h"
+#include "AG_TestEffects.h"
+
+/**
+ * ˺ۺϰԴȼͰ
+ * - Դͬһ֡ͬһĿ꣺ͬԴͬȼкϲһ GEͬԴ / ȼһΣInstigator ǸԵԴ
+ * - ɱ֡еԴȽ㣬ѪյǴ GE ԴõͽһԴ˺Լ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGDamageAccumulatorPerSourceTest, "ActionGame.Damage.AccumulatorPerSource",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGDamageAccumulatorPerSourceTest::RunTest(const FString& Parameters)
+{
+	constexpr float Bounty = 15.f;
+
+	IConsoleVariable* AggregateCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ag.Damage.Aggregate"));
+	if (!TestNotNull(TEXT("ag.Damage.Aggregate"), AggregateCVar))
+	{
+		return false;
+	}
+	const int32 SavedAggregate = AggregateCVar->GetInt();
+	AggregateCVar->Set(1, ECVF_SetByCode);
+
+	FAGTestWorld TestWorld;
+
+	AEnemyCharacterBase* SourceA = TestWorld.Spawn<AAG_TestGroundShooter>(FVector(0.f, 0.f, 100.f));
+	AEnemyCharacterBase* SourceB = TestWorld.Spawn<AAG_TestGroundShooter>(FVector(0.f, 400.f, 100.f));
+	AEnemyCharacterBase* Target = TestWorld.Spawn<AAG_TestGroundShooter>(FVector(400.f, 200.f, 100.f));
+	UAbilitySystemComponent* SourceASCA = SourceA ? SourceA->GetAbilitySystemComponent() : nullptr;
+	UAbilitySystemComponent* SourceASCB = SourceB ? SourceB->GetAbilitySystemComponent() : nullptr;
+	UAbilitySystemComponent* TargetASC = Target ? Target->GetAbilitySystemComponent() : nullptr;
+	if (!TestNotNull(TEXT("Source A ASC"), SourceASCA) || !TestNotNull(TEXT("Source B ASC"), SourceASCB) || !TestNotNull(TEXT("Target ASC"), TargetASC))
+	{
+		AggregateCVar->Set(SavedAggregate, ECVF_SetByCode);
+		return false;
+	}
+
+	SourceASCA->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetBountyGoldAttribute(), 0.f);
+	SourceASCB->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetBountyGoldAttribute(), 0.f);
+	TargetASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetMaxHealthAttribute(), 100.f);
+	TargetASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetHealthAttribute(), 100.f);
+	TargetASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetBountyGoldAttribute(), Bounty);
+	TestWorld.Tick();
+
+	// ÿ Health 仯 (Instigator, 仯) GE ֻһΣһ GE һ
+	TArray<TPair<AActor*, float>> Applications;
+	const FDelegateHandle HealthHandle = TargetASC->GetGameplayAttributeValueChangeDelegate(UAG_EnemyAttributeSet::GetHealthAttribute())
+		.AddLambda([&Applications](const FOnAttributeChangeData& Data)
+		{
+			AActor* Instigator = Data.GEModData ? Data.GEModData->EffectSpec.GetEffectContext().GetInstigator() : nullptr;
+			Applications.Emplace(Instigator, Data.NewValue - Data.OldValue);
+		});
+
+	auto Hit = [&](UAbilitySystemComponent* SourceASC, float Level, float Damage)
+	{
+		UAG_DamageAccumulatorSubsystem::ApplyDamage(SourceASC->GetAvatarActor(), SourceASC, TargetASC,
+			UAG_TestEffect_SetByCallerDamage::StaticClass(), Level, AGGameplayTags::Data_Damage, -Damage, SourceASC->MakeEffectContext());
+	};
+
+	auto SumFrom = [&Applications](AActor* Instigator, int32& OutCount)
+	{
+		float Sum = 0.f;
+		OutCount = 0;
+		for (const TPair<AActor*, float>& Application : Applications)
+		{
+			if (Application.Key == Instigator)
+			{
+				Sum += Application.Value;
+				++OutCount;
+			}
+		}
+		return Sum;
+	};
+
+	// ͬһ֡A Σ1 + һΣ2 B һ
+	Hit(SourceASCA, 1.f, 10.f);
+	Hit(SourceASCB, 1.f, 20.f);
+	Hit(SourceASCA, 1.f, 5.f);
+	Hit(SourceASCA, 2.f, 1.f);
+	TestEqual(TEXT("Nothing applied before the flush"), Applications.Num(), 0);
+	TestWorld.Tick();
+
+	int32 CountA = 0;
+	int32 CountB = 0;
+	const float DeltaA = SumFrom(SourceA, CountA);
+	const float DeltaB = SumFrom(SourceB, CountB);
+	TestEqual(TEXT("One application per (source, level) bucket"), Applications.Num(), 3);
+	TestEqual(TEXT("Source A applied once per level"), CountA, 2);
+	TestEqual(TEXT("Source B applied once"), CountB, 1);
+	TestEqual(TEXT("Source A damage is attributed to A"), DeltaA, -16.f);
+	TestEqual(TEXT("Source B damage is attributed to B"), DeltaB, -20.f);
+	TestEqual(TEXT("Total damage unchanged"), TargetASC->GetNumericAttribute(UAG_EnemyAttributeSet::GetHealthAttribute()), 64.f);
+
+	// ɱ֡B еA ĺϲ˺Ѫ
+	Applications.Reset();
+	Hit(SourceASCB, 1.f, 30.f);
+	Hit(SourceASCA, 1.f, 40.f);
+	Hit(SourceASCA, 1.f, 10.f);
+	TestWorld.Tick();
+
+	TestEqual(TEXT("Kill frame applies one GE per source"), Applications.Num(), 2);
+	if (Applications.Num() == 2)
+	{
+		TestTrue(TEXT("First-hit source is applied first"), Applications[0].Key == SourceB);
+		TestEqual(TEXT("Source B keeps its own damage"), Applications[0].Value, -30.f);
+		TestTrue(TEXT("Killing application comes from A"), Applications[1].Key == SourceA);
+	}
+	TestTrue(TEXT("Target dead"), TargetASC->HasMatchingGameplayTag(AGGameplayTags::State_Dead));
+
+	// з֡ͽ֮֡
+	for (int32 Frame = 0; Frame < 10; ++Frame)
+	{
+		TestWorld.Tick();
+	}
+	TestEqual(TEXT("Killer A receives the bounty"), SourceASCA->GetNumericAttribute(UAG_EnemyAttributeSet::GetBountyGoldAttribute()), Bounty);
+	TestEqual(TEXT("Source B receives nothing"), SourceASCB->GetNumericAttribute(UAG_EnemyAttributeSet::GetBountyGoldAttribute()), 0.f);
+
+	TargetASC->GetGameplayAttributeValueChangeDelegate(UAG_EnemyAttributeSet::GetHealthAttribute()).Remove(HealthHandle);
+	AggregateCVar->Set(SavedAggregate, ECVF_SetByCode);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
+#include "Characters/EnemyGroundShooterCharacter.h"
+#include "Subsystems/AG_AreaDamageSubsystem.h"
+
+/**
+ * һδ 300 
+ *  UGA_Ultimate::ApplyUltimateDamage ͬ·һ GatherTargets + һ Spec Ӧ
+ * - е֡е˶ State.DeadҲЧĿ
+ * - ֮֡ſڼ֡ʱ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGUltimateKills300Test, "ActionGame.Death.UltimateKills300",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGUltimateKills300Test::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumEnemies = 300;
+	constexpr float Radius = 3000.f;
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	UAG_AreaDamageSubsystem* AreaDamage = World->GetSubsystem<UAG_AreaDamageSubsystem>();
+	if (!TestNotNull(TEXT("AreaDamage subsystem"), AreaDamage))
+	{
+		return false;
+	}
+
+	TArray<AEnemyCharacterBase*> Enemies;
+	for (int32 Index = 0; Index < NumEnemies; ++Index)
+	{
+		const FVector Location(200.f * (Index % 20) - 2000.f, 200.f * (Index / 20) - 1500.f, 100.f);
+		AEnemyCharacterBase* Enemy = TestWorld.Spawn<AEnemyGroundShooterCharacter>(Location);
+		if (!Enemy || !Enemy->GetAbilitySystemComponent())
+		{
+			AddError(TEXT("Failed to spawn an enemy with an ASC"));
+			return false;
+		}
+
+		UAbilitySystemComponent* ASC = Enemy->GetAbilitySystemComponent();
+		ASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetMaxHealthAttribute(), 100.f);
+		ASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetHealthAttribute(), 100.f);
+		Enemies.Add(Enemy);
+	}
+
+	TestWorld.Tick();
+
+	UAbilitySystemComponent* SourceASC = Enemies[0]->GetAbilitySystemComponent();
+	UGameplayEffect* KillEffect = AGTest::MakeInstantAddEffect(UAG_EnemyAttributeSet::GetHealthAttribute(), -1000.f, TEXT("GE_Test_UltimateKill"));
+
+	// ֡
+	const double HitStart = FPlatformTime::Seconds();
+
+	TArray<UAbilitySystemComponent*> Targets;
+	AreaDamage->GatherTargets(FVector::ZeroVector, Radius, nullptr, AEnemyCharacterBase::StaticClass(), AGGameplayTags::State_Dead, Targets);
+
+	const FGameplayEffectSpec Spec(KillEffect, SourceASC->MakeEffectContext(), 1.f);
+	const int32 NumHit = UAG_AreaDamageSubsystem::ApplySpecToTargets(SourceASC, Spec, Targets);
+
+	const double HitFrameMs = (FPlatformTime::Seconds() - HitStart) * 1000.0 + TestWorld.TickTimed();
+
+	TestEqual(TEXT("Targets hit"), NumHit, NumEnemies);
+
+	int32 NumDead = 0;
+	for (const AEnemyCharacterBase* Enemy : Enemies)
+	{
+		NumDead += Enemy->IsDead() ? 1 : 0;
+	}
+	TestEqual(TEXT("Enemies dead on the hit frame"), NumDead, NumEnemies);
+
+	TArray<UAbilitySystemComponent*> RemainingTargets;
+	AreaDamage->GatherTargets(FVector::ZeroVector, Radius, nullptr, AEnemyCharacterBase::StaticClass(), AGGameplayTags::State_Dead, RemainingTargets);
+	TestEqual(TEXT("Dead enemies are no longer targets"), RemainingTargets.Num(), 0);
+
+	// ſڼ֡
+	double WorstQueueFrameMs = 0.0;
+	for (int32 Frame = 0; Frame < 60; ++Frame)
+	{
+		WorstQueueFrameMs = FMath::Max(WorstQueueFrameMs, TestWorld.TickTimed());
+	}
+
+	AddInfo(FString::Printf(TEXT("Ultimate x%d: hit frame %.3f ms, worst death-queue frame %.3f ms"),
+		NumEnemies, HitFrameMs, WorstQueueFrameMs));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Actors/DropVisualActor.h"
+
+namespace AGDropTests
+{
+	ADropVisualActor* Launch(FAGTestWorld& TestWorld, const FVector& Location, const FRotator& Rotation)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return TestWorld.Get()->SpawnActor<ADropVisualActor>(ADropVisualActor::StaticClass(), Location, Rotation, Params);
+	}
+}
+
+/**
+ * 赲ʱض
+ * - տĽ
+ * - ǰǽǽǰĵϣǽ
+ * - ǰ̨ף̨׶
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGDropArcBlockingTest, "ActionGame.Drops.ArcStopsAtBlockers",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGDropArcBlockingTest::RunTest(const FString& Parameters)
+{
+	using namespace AGDropTests;
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	// 涥 Z = 0
+	constexpr double FloorZ = 0.0;
+	if (!TestNotNull(TEXT("Floor"), AGTest::SpawnBlock(World, FVector(0.f, 0.f, FloorZ - 50.f), FVector(100.f, 100.f, 1.f))))
+	{
+		return false;
+	}
+
+	// +X  140 ǽ
+	constexpr double WallX = 140.0;
+	AGTest::SpawnBlock(World, FVector(WallX + 10.f, 0.f, 500.f), FVector(0.2f, 10.f, 10.f));
+
+	// +Y  100 ̨֮ף Z = 60
+	constexpr double StepY = 100.0;
+	constexpr double StepTopZ = 60.0;
+	AGTest::SpawnBlock(World, FVector(0.f, StepY + 500.f, StepTopZ - 50.f), FVector(10.f, 10.f, 1.f));
+
+	const FVector Start(0.f, 0.f, 80.f);
+
+	ADropVisualActor* OpenDrop = Launch(TestWorld, Start, FRotator(0.f, 180.f, 0.f));
+	ADropVisualActor* WallDrop = Launch(TestWorld, Start, FRotator(0.f, 0.f, 0.f));
+	ADropVisualActor* StepDrop = Launch(TestWorld, Start, FRotator(0.f, 90.f, 0.f));
+	if (!TestNotNull(TEXT("Open drop"), OpenDrop) || !TestNotNull(TEXT("Wall drop"), WallDrop) || !TestNotNull(TEXT("Step drop"), StepDrop))
+	{
+		return false;
+	}
+
+	const FDropArc& OpenArc = OpenDrop->GetDropArc();
+	const FDropArc& WallArc = WallDrop->GetDropArc();
+	const FDropArc& StepArc = StepDrop->GetDropArc();
+
+	AddInfo(FString::Printf(TEXT("Open: land %s after %.2f s; wall: land %s after %.2f s; step: land %s after %.2f s"),
+		*FVector(OpenArc.LandLocation).ToCompactString(), OpenArc.Duration,
+		*FVector(WallArc.LandLocation).ToCompactString(), WallArc.Duration,
+		*FVector(StepArc.LandLocation).ToCompactString(), StepArc.Duration));
+
+	// տǽԶû
+	TestTrue(TEXT("Open drop travels past the wall distance"), -OpenArc.LandLocation.X > WallX);
+	TestEqual(TEXT("Open drop lands on the floor"), OpenArc.LandLocation.Z, FloorZ, 1.0);
+
+	TestTrue(TEXT("Wall drop stays in front of the wall"), WallArc.LandLocation.X < WallX);
+	TestEqual(TEXT("Wall drop lands on the floor"), WallArc.LandLocation.Z, FloorZ, 1.0);
+	TestTrue(TEXT("Wall drop ends sooner"), WallArc.Duration < OpenArc.Duration);
+
+	TestEqual(TEXT("Step drop lands on the step"), StepArc.LandLocation.Z, StepTopZ, 1.0);
+	TestTrue(TEXT("Step drop lands past the step edge"), StepArc.LandLocation.Y > StepY);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
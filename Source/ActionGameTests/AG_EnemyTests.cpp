@@ -0,0 +1,270 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectHash.h"
+#include "HAL/IConsoleManager.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+#include "ActorComponents/AG_EnemyCombatComponent.h"
+#include "DataAssets/EnemyConfigDataAsset.h"
+#include "Subsystems/AG_AreaDamageSubsystem.h"
+#include "AG_TestActors.h"
+#include "AG_TestEffects.h"
+
+namespace AGEnemyTests
+{
+	/**  obj list ͳƿھһ£ + лɼĶѷ䣬Ӷ */
+	int64 CountActorBytes(AActor* Actor)
+	{
+		int64 Bytes = 0;
+		auto CountObject = [&Bytes](UObject* Object)
+		{
+			FArchiveCountMem CountMem(Object);
+			Bytes += Object->GetClass()->GetStructureSize() + CountMem.GetMax();
+		};
+
+		CountObject(Actor);
+		ForEachObjectWithOuter(Actor, CountObject, true);
+		return Bytes;
+	}
+
+	/**  EnemySpawnManager ͬӳɣFinishSpawning ǰд */
+	AAG_TestGroundShooter* SpawnConfigured(UWorld* World, UEnemyConfigDataAsset* Config, TSubclassOf<UGameplayEffect> InitEffectClass, const FVector& Location)
+	{
+		const FTransform Transform(Location);
+		AAG_TestGroundShooter* Enemy = World->SpawnActorDeferred<AAG_TestGroundShooter>(
+			AAG_TestGroundShooter::StaticClass(), Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		if (!Enemy)
+		{
+			return nullptr;
+		}
+
+		FEnemySpawnEntry Entry;
+		Entry.EnemyConfig = Config;
+		Enemy->InitFromSpawnEntry(Entry);
+		Enemy->SetInitEffectClass(InitEffectClass);
+		Enemy->FinishSpawning(Transform);
+		return Enemy;
+	}
+}
+
+/**
+ * ˣUAG_EnemyCombatComponent ASC ˵ĶԱ
+ * - ɣ BeginPlay ʼĵʱ͵ڴ
+ * - ˱ɱʱ˵ RewardEffectClass ɱ߷ͽ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLiteEnemyCostTest, "ActionGame.Enemy.LiteCombatComponentCost",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLiteEnemyCostTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumEnemies = 200;
+	constexpr float Bounty = 15.f;
+
+	FAGTestWorld TestWorld;
+
+	auto SpawnBatch = [&TestWorld](UClass* Class, float Y, TArray<AEnemyCharacterBase*>& OutEnemies)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumEnemies; ++Index)
+		{
+			OutEnemies.Add(TestWorld.Spawn<AEnemyCharacterBase>(Class, FVector(200.f * Index, Y, 100.f)));
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0;
+	};
+
+	TArray<AEnemyCharacterBase*> FullEnemies;
+	TArray<AEnemyCharacterBase*> LiteEnemies;
+	const double FullMs = SpawnBatch(AAG_TestGroundShooter::StaticClass(), 0.f, FullEnemies);
+	const double LiteMs = SpawnBatch(AAG_TestLiteGroundShooter::StaticClass(), 2000.f, LiteEnemies);
+
+	AEnemyCharacterBase* Killer = FullEnemies[0];
+	AEnemyCharacterBase* Victim = LiteEnemies[0];
+	if (!TestNotNull(TEXT("Full enemy ASC"), Killer ? Killer->GetAbilitySystemComponent() : nullptr)
+		|| !TestNotNull(TEXT("Lite enemy combat component"), Victim ? Victim->GetCombatComponent() : nullptr))
+	{
+		return false;
+	}
+	TestNull(TEXT("Lite enemy has no ASC"), Victim->GetAbilitySystemComponent());
+
+	int64 FullBytes = 0;
+	int64 LiteBytes = 0;
+	for (int32 Index = 0; Index < NumEnemies; ++Index)
+	{
+		FullBytes += AGEnemyTests::CountActorBytes(FullEnemies[Index]);
+		LiteBytes += AGEnemyTests::CountActorBytes(LiteEnemies[Index]);
+	}
+
+	AddInfo(FString::Printf(TEXT("Full (ASC) enemy: %.1f us spawn, %lld bytes"), FullMs * 1000.0 / NumEnemies, FullBytes / NumEnemies));
+	AddInfo(FString::Printf(TEXT("Lite enemy:       %.1f us spawn, %lld bytes"), LiteMs * 1000.0 / NumEnemies, LiteBytes / NumEnemies));
+	TestTrue(TEXT("Lite enemy is smaller than the ASC enemy"), LiteBytes < FullBytes);
+
+	// ͽ˵ RewardEffectClass֡ĩϲ
+	UAbilitySystemComponent* KillerASC = Killer->GetAbilitySystemComponent();
+	KillerASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetBountyGoldAttribute(), 0.f);
+
+	UAG_EnemyCombatComponent* Combat = Victim->GetCombatComponent();
+	Combat->InitAttributes(100.f, 100.f, 0.f, 1.f, Bounty);
+	Combat->ApplyDamage(1000.f, Killer);
+	TestTrue(TEXT("Lite enemy dead"), Combat->IsDead());
+
+	TestWorld.Tick();
+	TestEqual(TEXT("Killer received the lite enemy's bounty"),
+		KillerASC->GetNumericAttribute(UAG_EnemyAttributeSet::GetBountyGoldAttribute()), Bounty);
+
+	return true;
+}
+
+/**
+ * û ASC Ա
+ * - ˺ LiteSourceDamage-GetAttackDamage()ܺԼ AttackPower ޹
+ * - ܺߵ Spec ģ建ﲻ±ը GE
+ * - ԴԵ GE ܾ棬˺
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLiteSourceExplosionTest, "ActionGame.Enemy.LiteSourceExplosion",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLiteSourceExplosionTest::RunTest(const FString& Parameters)
+{
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	UAG_AreaDamageSubsystem* AreaDamage = World->GetSubsystem<UAG_AreaDamageSubsystem>();
+	AEnemyCharacterBase* Suicider = TestWorld.Spawn<AAG_TestLiteGroundShooter>(FVector(0.f, 0.f, 100.f));
+	AEnemyCharacterBase* Victim = TestWorld.Spawn<AAG_TestGroundShooter>(FVector(150.f, 0.f, 100.f));
+	UAG_AbilitySystemComponentBase* VictimASC = Victim ? Cast<UAG_AbilitySystemComponentBase>(Victim->GetAbilitySystemComponent()) : nullptr;
+	if (!TestNotNull(TEXT("AreaDamage subsystem"), AreaDamage) || !TestNotNull(TEXT("Lite suicider"), Suicider ? Suicider->GetCombatComponent() : nullptr)
+		|| !TestNotNull(TEXT("Victim ASC"), VictimASC))
+	{
+		return false;
+	}
+
+	// Ա 20 x 1.5 = 30ܺԼ AttackPower ܴһԴͻῴ
+	Suicider->GetCombatComponent()->InitAttributes(100.f, 100.f, 20.f, 1.5f, 0.f);
+	VictimASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetMaxHealthAttribute(), 100.f);
+	VictimASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetHealthAttribute(), 100.f);
+	VictimASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetAttackPowerAttribute(), 500.f);
+	TestWorld.Tick();
+
+	auto Explode = [&](TSubclassOf<UGameplayEffect> EffectClass)
+	{
+		FAreaDamageRequest Request;
+		Request.Instigator = Suicider;
+		Request.EffectClass = EffectClass;
+		Request.Origin = Suicider->GetActorLocation();
+		Request.Radius = 300.f;
+		Request.IgnoreTargetTag = AGGameplayTags::State_Dead;
+		Request.LiteSourceDamage = -Suicider->GetAttackDamage();
+		AreaDamage->QueueAreaDamage(Request);
+		TestWorld.Tick();
+	};
+
+	Explode(UAG_TestEffect_SetByCallerDamage::StaticClass());
+	TestEqual(TEXT("Explosion uses the suicider's attack damage"),
+		VictimASC->GetNumericAttribute(UAG_EnemyAttributeSet::GetHealthAttribute()), 70.f);
+	TestNull(TEXT("No explosion template in the victim's cache"),
+		VictimASC->FindSpecTemplate(UAG_TestEffect_SetByCallerDamage::StaticClass(), 1.f));
+
+	AddExpectedError(TEXT("captures source attributes"), EAutomationExpectedErrorFlags::Contains, 1);
+	Explode(UAG_TestEffect_SourceScaledDamage::StaticClass());
+	TestEqual(TEXT("Source-capturing GE is rejected for a lite source"),
+		VictimASC->GetNumericAttribute(UAG_EnemyAttributeSet::GetHealthAttribute()), 70.f);
+
+	return true;
+}
+
+/**
+ * Գʼֱд BaseValue Ӧ Init GE ĶԱ
+ * - ͬһ·õһ£ߵĵɺʱ
+ * - Init GE ʱʹ ag.Enemy.DirectInit Ҳ˵ GE
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGEnemyDirectInitTest, "ActionGame.Enemy.DirectAttributeInit",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGEnemyDirectInitTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumEnemies = 200;
+
+	IConsoleVariable* DirectInitCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ag.Enemy.DirectInit"));
+	if (!TestNotNull(TEXT("ag.Enemy.DirectInit"), DirectInitCVar))
+	{
+		return false;
+	}
+	const int32 SavedDirectInit = DirectInitCVar->GetInt();
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	UEnemyConfigDataAsset* Config = NewObject<UEnemyConfigDataAsset>(GetTransientPackage());
+	Config->EnemyConfigData.MaxHealth = 250.f;
+	Config->EnemyConfigData.Health = 200.f;
+	Config->EnemyConfigData.BaseAttackPower = 12.f;
+	Config->EnemyConfigData.AttackMultiplier = 1.5f;
+	Config->EnemyConfigData.BountyGold = 30.f;
+
+	const FGameplayAttribute Attributes[] =
+	{
+		UAG_EnemyAttributeSet::GetHealthAttribute(),
+		UAG_EnemyAttributeSet::GetMaxHealthAttribute(),
+		UAG_EnemyAttributeSet::GetAttackPowerAttribute(),
+		UAG_EnemyAttributeSet::GetAttackMultiplierAttribute(),
+		UAG_EnemyAttributeSet::GetBountyGoldAttribute(),
+	};
+
+	auto SpawnBatch = [&](int32 DirectInit, TSubclassOf<UGameplayEffect> InitEffectClass, float Y, AEnemyCharacterBase*& OutFirst)
+	{
+		DirectInitCVar->Set(DirectInit, ECVF_SetByCode);
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumEnemies; ++Index)
+		{
+			AEnemyCharacterBase* Enemy = AGEnemyTests::SpawnConfigured(World, Config, InitEffectClass, FVector(200.f * Index, Y, 100.f));
+			if (Index == 0)
+			{
+				OutFirst = Enemy;
+			}
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0 / NumEnemies;
+	};
+
+	AEnemyCharacterBase* ViaEffect = nullptr;
+	AEnemyCharacterBase* ViaDirect = nullptr;
+	AEnemyCharacterBase* WithBonus = nullptr;
+	const double EffectMs = SpawnBatch(0, UAG_TestEffect_EnemyInit::StaticClass(), 0.f, ViaEffect);
+	const double DirectMs = SpawnBatch(1, UAG_TestEffect_EnemyInit::StaticClass(), 2000.f, ViaDirect);
+	SpawnBatch(1, UAG_TestEffect_EnemyInitWithBonus::StaticClass(), 4000.f, WithBonus);
+	DirectInitCVar->Set(SavedDirectInit, ECVF_SetByCode);
+
+	if (!TestNotNull(TEXT("GE init enemy"), ViaEffect) || !TestNotNull(TEXT("Direct init enemy"), ViaDirect) || !TestNotNull(TEXT("Bonus init enemy"), WithBonus))
+	{
+		return false;
+	}
+
+	AddInfo(FString::Printf(TEXT("Enemy spawn with init GE:      %.1f us"), EffectMs * 1000.0));
+	AddInfo(FString::Printf(TEXT("Enemy spawn with direct init:  %.1f us"), DirectMs * 1000.0));
+
+	UAbilitySystemComponent* EffectASC = ViaEffect->GetAbilitySystemComponent();
+	UAbilitySystemComponent* DirectASC = ViaDirect->GetAbilitySystemComponent();
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		TestEqual(*FString::Printf(TEXT("%s matches between GE and direct init"), *Attribute.GetName()),
+			DirectASC->GetNumericAttribute(Attribute), EffectASC->GetNumericAttribute(Attribute));
+	}
+	TestEqual(TEXT("Init applied from config"), DirectASC->GetNumericAttribute(UAG_EnemyAttributeSet::GetMaxHealthAttribute()), 250.f);
+
+	// ε Init GE ˵ GE+5 
+	TestEqual(TEXT("Bonus init GE still applied"),
+		WithBonus->GetAbilitySystemComponent()->GetNumericAttribute(UAG_EnemyAttributeSet::GetAttackPowerAttribute()),
+		EffectASC->GetNumericAttribute(UAG_EnemyAttributeSet::GetAttackPowerAttribute()) + 5.f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
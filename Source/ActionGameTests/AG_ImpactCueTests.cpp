@@ -0,0 +1,239 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameplayEffectTypes.h"
+#include "ActionGameplayTags.h"
+#include "Subsystems/AG_ImpactCueSubsystem.h"
+#include "AG_TestActors.h"
+#include "AG_TestNet.h"
+
+namespace AGImpactCueTests
+{
+	constexpr int32 MaxEventsPerRPC = 64;
+
+	FHitResult MakeHit(const FVector& Location, const FVector& Normal)
+	{
+		FHitResult Hit;
+		Hit.Location = Location;
+		Hit.ImpactPoint = Location;
+		Hit.ImpactNormal = Normal;
+		return Hit;
+	}
+
+	/** һ RPC Ĳλ鳤 + ÿ¼ */
+	int64 GetBatchBits(TArray<FImpactCueEvent>& Batch, UPackageMap* Map)
+	{
+		FNetBitWriter Writer(Map, 64 * 1024);
+		uint32 Num = static_cast<uint32>(Batch.Num());
+		Writer.SerializeIntPacked(Num);
+		for (FImpactCueEvent& Event : Batch)
+		{
+			bool bOk = true;
+			Event.NetSerialize(Writer, Map, bOk);
+		}
+		return Writer.GetNumBits();
+	}
+}
+
+/**
+ *  Cue  QueueImpactCue -> Flush -> ClientReceiveImpactCues ʵʷ RPC
+ * - 8  8000 x 8000 ĳ 32 Уһ֡ÿֻյһ RPCǰӵü¼Լ
+ * - һ֡ڳ 64 ¼ʱɶ RPCÿ 64
+ * - ag.ImpactCues.Batch 0 ʱߴ RPC
+ * - ֽಥԱȣ·Ϊÿжÿһ Cue Tag + FGameplayCueParametersRPC ͷƣ UAG_TestPackageMap 
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGImpactCueBandwidthTest, "ActionGame.ImpactCues.BatchedBandwidth",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGImpactCueBandwidthTest::RunTest(const FString& Parameters)
+{
+	using namespace AGImpactCueTests;
+
+	constexpr int32 NumPlayers = 8;
+	constexpr int32 HitsPerPlayer = 32;
+	constexpr int32 BurstHits = 150;
+	constexpr float ArenaSize = 8000.f;
+	constexpr float HitSpread = 1500.f;
+
+	IConsoleVariable* BatchCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ag.ImpactCues.Batch"));
+	IConsoleVariable* RelevancyCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ag.ImpactCues.RelevancyDistance"));
+	if (!TestNotNull(TEXT("ag.ImpactCues.Batch"), BatchCVar) || !TestNotNull(TEXT("ag.ImpactCues.RelevancyDistance"), RelevancyCVar))
+	{
+		return false;
+	}
+	const int32 SavedBatch = BatchCVar->GetInt();
+	const float Relevancy = RelevancyCVar->GetFloat();
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+	FRandomStream Random(27);
+
+	UAG_ImpactCueSubsystem* Subsystem = World->GetSubsystem<UAG_ImpactCueSubsystem>();
+	if (!TestNotNull(TEXT("Impact cue subsystem"), Subsystem))
+	{
+		return false;
+	}
+
+	TArray<AAG_TestPlayerController*> Controllers;
+	TArray<ADefaultPawn*> Players;
+	for (int32 Index = 0; Index < NumPlayers; ++Index)
+	{
+		const FVector Location(Random.FRandRange(0.f, ArenaSize), Random.FRandRange(0.f, ArenaSize), 100.f);
+		AAG_TestPlayerController* Controller = World->SpawnActor<AAG_TestPlayerController>();
+		ADefaultPawn* Player = TestWorld.Spawn<ADefaultPawn>(Location);
+		if (!TestNotNull(TEXT("Player controller"), Controller) || !TestNotNull(TEXT("Player pawn"), Player))
+		{
+			return false;
+		}
+		Controller->Possess(Player);
+		Controllers.Add(Controller);
+		Players.Add(Player);
+	}
+
+	for (AAG_TestPlayerController* Controller : Controllers)
+	{
+		if (!TestTrue(TEXT("View target is the possessed pawn"), Controller->GetViewTarget() == Controller->GetPawn()))
+		{
+			return false;
+		}
+	}
+
+	TArray<FHitResult> Hits;
+	TArray<ADefaultPawn*> Shooters;
+	for (ADefaultPawn* Shooter : Players)
+	{
+		for (int32 Hit = 0; Hit < HitsPerPlayer; ++Hit)
+		{
+			const FVector Offset(Random.FRandRange(-HitSpread, HitSpread), Random.FRandRange(-HitSpread, HitSpread), 0.f);
+			Hits.Add(MakeHit(Shooter->GetActorLocation() + Offset, Random.GetUnitVector()));
+			Shooters.Add(Shooter);
+		}
+	}
+
+	auto QueueHits = [&]()
+	{
+		for (int32 Index = 0; Index < Hits.Num(); ++Index)
+		{
+			Subsystem->QueueImpactCue(AGGameplayTags::GameplayCue_Weapon_Impact, Hits[Index], Shooters[Index]);
+		}
+	};
+
+	auto ResetReceived = [&]()
+	{
+		for (AAG_TestPlayerController* Controller : Controllers)
+		{
+			Controller->ImpactCueBatches.Reset();
+		}
+	};
+
+	// · ExecuteGameplayCue RPC һ
+	BatchCVar->Set(0, ECVF_SetByCode);
+	QueueHits();
+	TestWorld.Tick();
+	for (AAG_TestPlayerController* Controller : Controllers)
+	{
+		TestEqual(TEXT("No batched RPCs with ag.ImpactCues.Batch 0"), Controller->ImpactCueBatches.Num(), 0);
+	}
+
+	// ·һ֡ÿһ RPC
+	BatchCVar->Set(1, ECVF_SetByCode);
+	ResetReceived();
+	QueueHits();
+	TestWorld.Tick();
+
+	UPackageMap* Map = NewObject<UAG_TestPackageMap>();
+	int64 BatchedRPCs = 0;
+	int64 BatchedBits = 0;
+	int32 NumCulled = 0;
+	for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; ++PlayerIndex)
+	{
+		AAG_TestPlayerController* Controller = Controllers[PlayerIndex];
+		ADefaultPawn* Viewer = Players[PlayerIndex];
+
+		int32 NumRelevant = 0;
+		int32 NumOwn = 0;
+		for (int32 Index = 0; Index < Hits.Num(); ++Index)
+		{
+			if (Shooters[Index] == Viewer)
+			{
+				++NumOwn;
+				++NumRelevant;
+			}
+			else if (FVector::Dist(Viewer->GetActorLocation(), Hits[Index].ImpactPoint) <= Relevancy)
+			{
+				++NumRelevant;
+			}
+		}
+		NumCulled += Hits.Num() - NumRelevant;
+
+		int32 NumReceived = 0;
+		int32 NumOwnReceived = 0;
+		for (TArray<FImpactCueEvent>& Batch : Controller->ImpactCueBatches)
+		{
+			TestTrue(TEXT("No RPC carries more than 64 events"), Batch.Num() <= MaxEventsPerRPC);
+			NumReceived += Batch.Num();
+			NumOwnReceived += Batch.FilterByPredicate([Viewer](const FImpactCueEvent& Event) { return Event.Instigator == Viewer; }).Num();
+			BatchedBits += GetBatchBits(Batch, Map);
+		}
+		BatchedRPCs += Controller->ImpactCueBatches.Num();
+
+		TestEqual(TEXT("One RPC per player per 64 relevant events"), Controller->ImpactCueBatches.Num(), FMath::DivideAndRoundUp(NumRelevant, MaxEventsPerRPC));
+		TestEqual(TEXT("Each player receives exactly its relevant events"), NumReceived, NumRelevant);
+		TestEqual(TEXT("A player's own hits are never culled"), NumOwnReceived, NumOwn);
+	}
+	TestTrue(TEXT("Some hits are culled by distance"), NumCulled > 0);
+
+	// ·ֽÿһζಥ
+	int64 MulticastBits = 0;
+	for (int32 Index = 0; Index < Hits.Num(); ++Index)
+	{
+		FGameplayTag CueTag = AGGameplayTags::GameplayCue_Weapon_Impact;
+		FGameplayCueParameters CueParams;
+		CueParams.Location = Hits[Index].ImpactPoint;
+		CueParams.Normal = Hits[Index].ImpactNormal;
+		CueParams.Instigator = Shooters[Index];
+		CueParams.EffectCauser = Shooters[Index];
+
+		FNetBitWriter Writer(Map, 4096);
+		bool bOk = true;
+		CueTag.NetSerialize(Writer, Map, bOk);
+		CueParams.NetSerialize(Writer, Map, bOk);
+		MulticastBits += Writer.GetNumBits();
+	}
+	const int64 UnbatchedRPCs = static_cast<int64>(Hits.Num()) * NumPlayers;
+	const int64 UnbatchedBits = MulticastBits * NumPlayers;
+
+	AddInfo(FString::Printf(TEXT("%d hits, %d players: unbatched %lld RPCs / %lld bytes, batched %lld RPCs / %lld bytes (%d events culled)"),
+		Hits.Num(), NumPlayers, UnbatchedRPCs, (UnbatchedBits + 7) / 8, BatchedRPCs, (BatchedBits + 7) / 8, NumCulled));
+
+	TestTrue(TEXT("Batching sends fewer RPCs"), BatchedRPCs < UnbatchedRPCs);
+	TestTrue(TEXT("Batching sends fewer bytes"), BatchedBits < UnbatchedBits);
+
+	// һһ֡ 150 У 64 + 64 + 22
+	ResetReceived();
+	ADefaultPawn* Burster = Players[0];
+	for (int32 Hit = 0; Hit < BurstHits; ++Hit)
+	{
+		Subsystem->QueueImpactCue(AGGameplayTags::GameplayCue_Weapon_Impact, MakeHit(Burster->GetActorLocation() + FVector(100.f, 0.f, 0.f), FVector::UpVector), Burster);
+	}
+	TestWorld.Tick();
+
+	const TArray<TArray<FImpactCueEvent>>& BurstBatches = Controllers[0]->ImpactCueBatches;
+	if (TestEqual(TEXT("Burst split into 64-event RPCs"), BurstBatches.Num(), FMath::DivideAndRoundUp(BurstHits, MaxEventsPerRPC)))
+	{
+		TestEqual(TEXT("First chunk is full"), BurstBatches[0].Num(), MaxEventsPerRPC);
+		TestEqual(TEXT("Last chunk carries the remainder"), BurstBatches.Last().Num(), BurstHits % MaxEventsPerRPC);
+	}
+
+	BatchCVar->Set(SavedBatch, ECVF_SetByCode);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,146 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/Abilities/GA_Interact.h"
+#include "ActorComponents/InteractCandidateComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "AG_TestActors.h"
+
+/**
+ * ÿνֻһĿ
+ * CanActivateCheckCost/ ActivateAbility / CommitAbilityCheckCost + ApplyCostһѡ
+ * ֡ͬһ֡ҪһΣÿζִеĿ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGInteractSingleResolveTest, "ActionGame.Interact.SingleTargetResolve",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGInteractSingleResolveTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumInteractions = 20;
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	APlayerController* Controller = World->SpawnActor<APlayerController>();
+	AAG_TestPlayerCharacter* Character = TestWorld.Spawn<AAG_TestPlayerCharacter>(FVector(0.f, 0.f, 100.f));
+	AAG_TestInteractable* Target = TestWorld.Spawn<AAG_TestInteractable>(FVector(200.f, 0.f, 100.f));
+	if (!TestNotNull(TEXT("Player controller"), Controller) || !TestNotNull(TEXT("Player character"), Character)
+		|| !TestNotNull(TEXT("Interact target"), Target))
+	{
+		return false;
+	}
+	AGTest::GivePlayerState(Controller);
+	Controller->Possess(Character);
+	Controller->SetControlRotation(FRotator::ZeroRotator);
+	TestWorld.Tick();
+
+	UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+	UInteractCandidateComponent* Candidates = Character->FindComponentByClass<UInteractCandidateComponent>();
+	if (!TestNotNull(TEXT("ASC"), ASC) || !TestNotNull(TEXT("Interact candidate component"), Candidates))
+	{
+		return false;
+	}
+
+	const FGameplayAbilitySpecHandle Handle = ASC->GiveAbility(FGameplayAbilitySpec(UGA_Interact::StaticClass(), 1));
+	const FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(Handle);
+	const UGA_Interact* Ability = Spec ? Cast<UGA_Interact>(Spec->GetPrimaryInstance()) : nullptr;
+	if (!TestNotNull(TEXT("Interact ability instance"), Ability))
+	{
+		return false;
+	}
+
+	auto Interact = [&](const TCHAR* Label, int32 Index)
+	{
+		const int32 PrevInteracts = Target->NumInteracts;
+		TestTrue(*FString::Printf(TEXT("%s %d activates"), Label, Index), ASC->TryActivateAbility(Handle));
+		TestEqual(*FString::Printf(TEXT("%s %d executes the target once"), Label, Index), Target->NumInteracts - PrevInteracts, 1);
+		TestEqual(*FString::Printf(TEXT("%s %d resolves the target once"), Label, Index), Ability->GetNumTargetResolves(), 1);
+	};
+
+	for (int32 Index = 0; Index < NumInteractions; ++Index)
+	{
+		Interact(TEXT("Interaction across frames"), Index);
+		TestWorld.Tick();
+	}
+
+	for (int32 Index = 0; Index < NumInteractions; ++Index)
+	{
+		Interact(TEXT("Interaction in one frame"), Index);
+	}
+
+	AddInfo(FString::Printf(TEXT("%d interactions, %d target executions"), NumInteractions * 2, Target->NumInteracts));
+	return true;
+}
+
+/**
+ * ɽƶɽȶʱ
+ * - ag.Interact.UpdateRate £ֻƶص·ָ + GA_Interact ʱѡ
+ * - ĿԶһӣƵǰͬһ֡ɹ
+ * - ĿƵϵ뾶һεĺѡٷУܾ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGInteractMovedInteractableTest, "ActionGame.Interact.MovedInteractable",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGInteractMovedInteractableTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* UpdateRateCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ag.Interact.UpdateRate"));
+	if (!TestNotNull(TEXT("ag.Interact.UpdateRate"), UpdateRateCVar))
+	{
+		return false;
+	}
+	const float SavedUpdateRate = UpdateRateCVar->GetFloat();
+	UpdateRateCVar->Set(0.001f, ECVF_SetByCode);
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	APlayerController* Controller = World->SpawnActor<APlayerController>();
+	AAG_TestPlayerCharacter* Character = TestWorld.Spawn<AAG_TestPlayerCharacter>(FVector(0.f, 0.f, 100.f));
+	AAG_TestInteractable* Target = TestWorld.Spawn<AAG_TestInteractable>(FVector(0.f, 3000.f, 100.f));
+	if (!TestNotNull(TEXT("Player controller"), Controller) || !TestNotNull(TEXT("Player character"), Character)
+		|| !TestNotNull(TEXT("Interact target"), Target))
+	{
+		UpdateRateCVar->Set(SavedUpdateRate, ECVF_SetByCode);
+		return false;
+	}
+	AGTest::GivePlayerState(Controller);
+	Controller->Possess(Character);
+	Controller->SetControlRotation(FRotator::ZeroRotator);
+	TestWorld.Tick();
+
+	UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+	UInteractCandidateComponent* Candidates = Character->FindComponentByClass<UInteractCandidateComponent>();
+	if (!TestNotNull(TEXT("ASC"), ASC) || !TestNotNull(TEXT("Interact candidate component"), Candidates))
+	{
+		UpdateRateCVar->Set(SavedUpdateRate, ECVF_SetByCode);
+		return false;
+	}
+
+	const FGameplayAbilitySpecHandle Handle = ASC->GiveAbility(FGameplayAbilitySpec(UGA_Interact::StaticClass(), 1));
+
+	ASC->TryActivateAbility(Handle);
+	TestEqual(TEXT("Far target is not interacted with"), Target->NumInteracts, 0);
+
+	// 1) ƵǰѯֻҸĸӣû·ָҲ
+	Target->SetActorLocation(FVector(200.f, 0.f, 100.f));
+	TestTrue(TEXT("Interact activates right after the target moved into range"), ASC->TryActivateAbility(Handle));
+	TestEqual(TEXT("Moved target is interacted with without waiting for an update"), Target->NumInteracts, 1);
+	TestTrue(TEXT("Moved target is a candidate"), Candidates->IsInteractCandidate(Target));
+
+	// 2) Ƴ뾶ϣѡﻹһεĽ
+	Target->SetActorLocation(FVector(600.f, 0.f, 100.f));
+	ASC->TryActivateAbility(Handle);
+	TestEqual(TEXT("Target moved out of range is rejected"), Target->NumInteracts, 1);
+	TestFalse(TEXT("Target moved out of range is no longer a candidate"), Candidates->IsInteractCandidate(Target));
+
+	UpdateRateCVar->Set(SavedUpdateRate, ECVF_SetByCode);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,373 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "AIController.h"
+#include "AbilitySystemComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
+#include "ActorComponents/AG_CharacterMovementComponent.h"
+#include "AG_TestActors.h"
+
+namespace AGMovementTests
+{
+	constexpr float BaseMoveSpeed = 600.f;
+
+	/** ɽɫ Controllerдƶٶ */
+	AAG_TestPlayerCharacter* SpawnMover(FAGTestWorld& TestWorld, AController* Controller, const FVector& Location)
+	{
+		AAG_TestPlayerCharacter* Character = TestWorld.Spawn<AAG_TestPlayerCharacter>(Location);
+		if (!Character)
+		{
+			return nullptr;
+		}
+
+		if (Controller)
+		{
+			AGTest::GivePlayerState(Controller);
+			Controller->Possess(Character);
+		}
+
+		if (UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent())
+		{
+			ASC->SetNumericAttributeBase(UAG_AttributeSetBase::GetBaseMoveSpeedAttribute(), BaseMoveSpeed);
+			ASC->SetNumericAttributeBase(UAG_AttributeSetBase::GetMoveSpeedMultiplierAttribute(), 1.f);
+		}
+		return Character;
+	}
+
+	UAG_CharacterMovementComponent* GetMovement(ACharacter* Character)
+	{
+		return Character ? Cast<UAG_CharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+	}
+}
+
+/**
+ * ֻ Move  FLAG_Custom_1 ڷ
+ * - ͻ RequestDash 󱣴 Move  FLAG_Custom_1̹е Move ¼ʣʱҲ Move ϲ
+ * - ""ɫֻյ UpdateFromCompressedFlagsͻͬһ֡ʼ̣֮ÿ֡λȫһ£ᴥ
+ * ɫûе棬ǰ󶼴״̬޹صĲҲһ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGDashSavedMoveTest, "ActionGame.Movement.DashSavedMoveReplay",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGDashSavedMoveTest::RunTest(const FString& Parameters)
+{
+	using namespace AGMovementTests;
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	APlayerController* ClientController = World->SpawnActor<APlayerController>();
+	AAIController* ServerController = World->SpawnActor<AAIController>();
+	AAG_TestPlayerCharacter* Client = SpawnMover(TestWorld, ClientController, FVector(0.f, 0.f, 1000.f));
+	AAG_TestPlayerCharacter* Server = SpawnMover(TestWorld, ServerController, FVector(0.f, 1000.f, 1000.f));
+	UAG_CharacterMovementComponent* ClientMove = GetMovement(Client);
+	UAG_CharacterMovementComponent* ServerMove = GetMovement(Server);
+	if (!TestNotNull(TEXT("Client movement"), ClientMove) || !TestNotNull(TEXT("Server movement"), ServerMove))
+	{
+		return false;
+	}
+
+	FNetworkPredictionData_Client_Character* ClientData = ClientMove->GetPredictionData_Client_Character();
+	if (!TestNotNull(TEXT("Client prediction data"), ClientData))
+	{
+		return false;
+	}
+
+	constexpr float DeltaTime = 1.f / 60.f;
+	TestWorld.Tick(DeltaTime);
+
+	// ͻ̣һ֡ Move
+	ClientMove->RequestDash();
+	FSavedMove_AG DashMove;
+	DashMove.SetMoveFor(Client, DeltaTime, FVector::ZeroVector, *ClientData);
+	const uint8 Flags = DashMove.GetCompressedFlags();
+	TestTrue(TEXT("Dash request rides in FLAG_Custom_1"), (Flags & FSavedMove_Character::FLAG_Custom_1) != 0);
+
+	// ֻ flags õͼ
+	ServerMove->UpdateFromCompressedFlags(Flags);
+
+	const FVector ClientStart = Client->GetActorLocation();
+	const FVector ServerStart = Server->GetActorLocation();
+
+	TestWorld.Tick(DeltaTime);
+	TestTrue(TEXT("Client is dashing"), ClientMove->IsDashing());
+	TestTrue(TEXT("Server is dashing from the flag alone"), ServerMove->IsDashing());
+
+	// е Move ¼ʣʱ䣬Ҳһ Move ϲ
+	FSavedMovePtr MidDashMove = MakeShared<FSavedMove_AG>();
+	MidDashMove->SetMoveFor(Client, DeltaTime, FVector::ZeroVector, *ClientData);
+	TestTrue(TEXT("Mid-dash move saves the remaining dash time"), static_cast<FSavedMove_AG*>(MidDashMove.Get())->SavedDashTimeRemaining > 0.f);
+
+	FSavedMovePtr NextMove = MakeShared<FSavedMove_AG>();
+	NextMove->SetMoveFor(Client, DeltaTime, FVector::ZeroVector, *ClientData);
+	TestFalse(TEXT("Mid-dash moves are not combined"), MidDashMove->CanCombineWith(NextMove, Client, 1.f));
+
+	const int32 NumTicks = FMath::CeilToInt(ClientMove->GetDashDuration() / DeltaTime) + 10;
+	float MaxError = 0.f;
+	for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+	{
+		TestWorld.Tick(DeltaTime);
+
+		const FVector ClientOffset = Client->GetActorLocation() - ClientStart;
+		const FVector ServerOffset = Server->GetActorLocation() - ServerStart;
+		MaxError = FMath::Max(MaxError, static_cast<float>(FVector::Dist(ClientOffset, ServerOffset)));
+	}
+
+	const float DashDistance = static_cast<float>((Client->GetActorLocation() - ClientStart).Size2D());
+	AddInfo(FString::Printf(TEXT("Dash moved %.1f units in %d frames, max client/server divergence %.4f"), DashDistance, NumTicks + 1, MaxError));
+
+	TestFalse(TEXT("Dash ends"), ClientMove->IsDashing() || ServerMove->IsDashing());
+	TestTrue(TEXT("Dash moved the character"), DashDistance > 100.f);
+	TestTrue(TEXT("Server replays the dash without divergence"), MaxError < 0.1f);
+
+	return true;
+}
+
+/**
+ * ͼֻ Move  FLAG_Custom_0 ڷ
+ * - ͻ SetSprinting 󱣴 Move  FLAG_Custom_0PrepMoveFor طʱָ
+ * - ״̬ͬ Move ϲ
+ * - ""ɫֻյ UpdateFromCompressedFlagsGetMaxSpeed ͻһ£ͬλһ£ᴥ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGSprintSavedMoveTest, "ActionGame.Movement.SprintSavedMoveFlags",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGSprintSavedMoveTest::RunTest(const FString& Parameters)
+{
+	using namespace AGMovementTests;
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	// ֻڵЧ
+	if (!TestNotNull(TEXT("Floor"), AGTest::SpawnBlock(World, FVector(0.f, 0.f, -50.f), FVector(200.f, 200.f, 1.f))))
+	{
+		return false;
+	}
+
+	APlayerController* ClientController = World->SpawnActor<APlayerController>();
+	AAIController* ServerController = World->SpawnActor<AAIController>();
+	AAG_TestPlayerCharacter* Client = SpawnMover(TestWorld, ClientController, FVector(0.f, 0.f, 120.f));
+	AAG_TestPlayerCharacter* Server = SpawnMover(TestWorld, ServerController, FVector(0.f, 1000.f, 120.f));
+	UAG_CharacterMovementComponent* ClientMove = GetMovement(Client);
+	UAG_CharacterMovementComponent* ServerMove = GetMovement(Server);
+	if (!TestNotNull(TEXT("Client movement"), ClientMove) || !TestNotNull(TEXT("Server movement"), ServerMove))
+	{
+		return false;
+	}
+
+	FNetworkPredictionData_Client_Character* ClientData = ClientMove->GetPredictionData_Client_Character();
+	if (!TestNotNull(TEXT("Client prediction data"), ClientData))
+	{
+		return false;
+	}
+
+	// 
+	constexpr float DeltaTime = 1.f / 60.f;
+	for (int32 Tick = 0; Tick < 60; ++Tick)
+	{
+		TestWorld.Tick(DeltaTime);
+	}
+	if (!TestTrue(TEXT("Both characters land"), ClientMove->IsMovingOnGround() && ServerMove->IsMovingOnGround()))
+	{
+		return false;
+	}
+
+	// ͻ˿ʼܣһ֡ Move
+	ClientMove->SetSprinting(true);
+	FSavedMovePtr SprintMove = MakeShared<FSavedMove_AG>();
+	SprintMove->SetMoveFor(Client, DeltaTime, FVector::ZeroVector, *ClientData);
+	const uint8 Flags = SprintMove->GetCompressedFlags();
+	TestTrue(TEXT("Sprint intent rides in FLAG_Custom_0"), (Flags & FSavedMove_Character::FLAG_Custom_0) != 0);
+	TestTrue(TEXT("Client sprint speed is above walk speed"), ClientMove->GetMaxSpeed() > BaseMoveSpeed);
+
+	// ֻ flags õͼ
+	ServerMove->UpdateFromCompressedFlags(Flags);
+	TestTrue(TEXT("Server sprints from the flag alone"), ServerMove->IsSprinting());
+	TestTrue(TEXT("Server max speed matches the client"), FMath::IsNearlyEqual(ServerMove->GetMaxSpeed(), ClientMove->GetMaxSpeed(), 0.01f));
+
+	// طţɿܺ PrepMoveFor ָʱͼ
+	ClientMove->SetSprinting(false);
+	TestTrue(TEXT("Client walk speed"), FMath::IsNearlyEqual(ClientMove->GetMaxSpeed(), BaseMoveSpeed, 0.01f));
+
+	FSavedMovePtr WalkMove = MakeShared<FSavedMove_AG>();
+	WalkMove->SetMoveFor(Client, DeltaTime, FVector::ZeroVector, *ClientData);
+	TestTrue(TEXT("Walk move has no sprint flag"), (WalkMove->GetCompressedFlags() & FSavedMove_Character::FLAG_Custom_0) == 0);
+	TestFalse(TEXT("Sprint and walk moves are not combined"), SprintMove->CanCombineWith(WalkMove, Client, 1.f));
+
+	SprintMove->PrepMoveFor(Client);
+	TestTrue(TEXT("Replayed move restores sprint"), ClientMove->IsSprinting());
+
+	// ͬһΣͻλһ
+	const FVector ClientStart = Client->GetActorLocation();
+	const FVector ServerStart = Server->GetActorLocation();
+	constexpr int32 NumTicks = 60;
+	float MaxError = 0.f;
+	for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+	{
+		Client->AddMovementInput(FVector::ForwardVector);
+		Server->AddMovementInput(FVector::ForwardVector);
+		TestWorld.Tick(DeltaTime);
+
+		const FVector ClientOffset = Client->GetActorLocation() - ClientStart;
+		const FVector ServerOffset = Server->GetActorLocation() - ServerStart;
+		MaxError = FMath::Max(MaxError, static_cast<float>(FVector::Dist(ClientOffset, ServerOffset)));
+	}
+
+	const float RunDistance = static_cast<float>((Client->GetActorLocation() - ClientStart).Size2D());
+	AddInfo(FString::Printf(TEXT("Sprinted %.1f units in %d frames (walk cap %.1f), max client/server divergence %.4f"),
+		RunDistance, NumTicks, BaseMoveSpeed * NumTicks * DeltaTime, MaxError));
+
+	TestTrue(TEXT("Sprint outruns walk speed"), RunDistance > BaseMoveSpeed * NumTicks * DeltaTime);
+	TestTrue(TEXT("Server replays the sprint without divergence"), MaxError < 0.1f);
+
+	// յܵ flags صٶ
+	ServerMove->UpdateFromCompressedFlags(0);
+	TestTrue(TEXT("Server walks once the flag clears"), FMath::IsNearlyEqual(ServerMove->GetMaxSpeed(), BaseMoveSpeed, 0.01f));
+
+	return true;
+}
+
+/**
+ * GetMaxSpeed Ի
+ * - Ա仯 Base /  Multiplier󻺴ֱֵӶһ
+ * - ׼GetMaxSpeed εúʱ50 ɫƶʱ World Tick ʱ濪 / ظһ飬ֻ治ж
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGMaxSpeedCacheTest, "ActionGame.Movement.MaxSpeedCache",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGMaxSpeedCacheTest::RunTest(const FString& Parameters)
+{
+	using namespace AGMovementTests;
+
+	IConsoleVariable* CacheCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ag.Move.CacheAttributes"));
+	if (!TestNotNull(TEXT("ag.Move.CacheAttributes"), CacheCVar))
+	{
+		return false;
+	}
+	const int32 SavedCache = CacheCVar->GetInt();
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	if (!TestNotNull(TEXT("Floor"), AGTest::SpawnBlock(World, FVector(0.f, 0.f, -50.f), FVector(400.f, 400.f, 1.f))))
+	{
+		return false;
+	}
+
+	constexpr int32 NumMovers = 50;
+	TArray<AAG_TestPlayerCharacter*> Movers;
+	for (int32 Index = 0; Index < NumMovers; ++Index)
+	{
+		AAIController* Controller = World->SpawnActor<AAIController>();
+		AAG_TestPlayerCharacter* Mover = SpawnMover(TestWorld, Controller, FVector(-15000.f, 300.f * Index - 7500.f, 120.f));
+		if (!TestNotNull(TEXT("Mover"), Mover))
+		{
+			return false;
+		}
+		Movers.Add(Mover);
+	}
+
+	AAG_TestPlayerCharacter* Character = Movers[0];
+	UAG_CharacterMovementComponent* Movement = GetMovement(Character);
+	UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+	if (!TestNotNull(TEXT("Movement"), Movement) || !TestNotNull(TEXT("ASC"), ASC))
+	{
+		return false;
+	}
+
+	auto LiveSpeed = [ASC]()
+	{
+		return ASC->GetNumericAttribute(UAG_AttributeSetBase::GetBaseMoveSpeedAttribute())
+			* ASC->GetNumericAttribute(UAG_AttributeSetBase::GetMoveSpeedMultiplierAttribute());
+	};
+
+	// Ա仯
+	CacheCVar->Set(1, ECVF_SetByCode);
+	TestTrue(TEXT("Cached speed matches attributes"), FMath::IsNearlyEqual(Movement->GetMaxSpeed(), LiveSpeed(), 0.01f));
+
+	ASC->SetNumericAttributeBase(UAG_AttributeSetBase::GetMoveSpeedMultiplierAttribute(), 1.25f);
+	TestTrue(TEXT("Cache refreshes on multiplier change"), FMath::IsNearlyEqual(Movement->GetMaxSpeed(), BaseMoveSpeed * 1.25f, 0.01f));
+
+	ASC->SetNumericAttributeBase(UAG_AttributeSetBase::GetBaseMoveSpeedAttribute(), 400.f);
+	TestTrue(TEXT("Cache refreshes on base speed change"), FMath::IsNearlyEqual(Movement->GetMaxSpeed(), 400.f * 1.25f, 0.01f));
+
+	CacheCVar->Set(0, ECVF_SetByCode);
+	TestTrue(TEXT("Uncached speed matches cached speed"), FMath::IsNearlyEqual(Movement->GetMaxSpeed(), 400.f * 1.25f, 0.01f));
+
+	ASC->SetNumericAttributeBase(UAG_AttributeSetBase::GetBaseMoveSpeedAttribute(), BaseMoveSpeed);
+	ASC->SetNumericAttributeBase(UAG_AttributeSetBase::GetMoveSpeedMultiplierAttribute(), 1.f);
+
+	// GetMaxSpeed ε
+	constexpr int32 NumCalls = 1000000;
+	auto TimeCalls = [&](int32 bCache, double& OutSum)
+	{
+		CacheCVar->Set(bCache, ECVF_SetByCode);
+
+		OutSum = 0.0;
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Call = 0; Call < NumCalls; ++Call)
+		{
+			OutSum += Movement->GetMaxSpeed();
+		}
+		return (FPlatformTime::Seconds() - Start) * 1.0e9 / NumCalls;
+	};
+
+	double CachedSum = 0.0;
+	double LiveSum = 0.0;
+	const double LiveNs = TimeCalls(0, LiveSum);
+	const double CachedNs = TimeCalls(1, CachedSum);
+	TestTrue(TEXT("Cached and uncached calls agree"), FMath::IsNearlyEqual(CachedSum, LiveSum, 1.0));
+
+	AddInfo(FString::Printf(TEXT("GetMaxSpeed uncached: %.2f ns/call"), LiveNs));
+	AddInfo(FString::Printf(TEXT("GetMaxSpeed cached:   %.2f ns/call"), CachedNs));
+	if (CachedNs > LiveNs)
+	{
+		AddWarning(TEXT("Cached GetMaxSpeed was not faster than reading attributes; timing is noisy on shared machines"));
+	}
+
+	// 50 ɫƶ World Tick
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr int32 NumTicks = 120;
+	auto TimeTicks = [&](int32 bCache, const FVector& Direction)
+	{
+		CacheCVar->Set(bCache, ECVF_SetByCode);
+
+		double TotalMs = 0.0;
+		for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+		{
+			for (AAG_TestPlayerCharacter* Mover : Movers)
+			{
+				Mover->AddMovementInput(Direction);
+			}
+
+			const double Start = FPlatformTime::Seconds();
+			TestWorld.Tick(DeltaTime);
+			TotalMs += (FPlatformTime::Seconds() - Start) * 1000.0;
+		}
+		return TotalMs / NumTicks;
+	};
+
+	// أظһ
+	for (int32 Tick = 0; Tick < 60; ++Tick)
+	{
+		TestWorld.Tick(DeltaTime);
+	}
+	const double LiveTickMs = TimeTicks(0, FVector::ForwardVector);
+	const double CachedTickMs = TimeTicks(1, FVector::BackwardVector);
+
+	AddInfo(FString::Printf(TEXT("World tick with %d movers, uncached: %.3f ms"), NumMovers, LiveTickMs));
+	AddInfo(FString::Printf(TEXT("World tick with %d movers, cached:   %.3f ms"), NumMovers, CachedTickMs));
+
+	CacheCVar->Set(SavedCache, ECVF_SetByCode);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+/**
+ * ģԴﲻַ GameplayTag
+ * C++ õ Tag Ӧ AGGameplayTags ɨ Source/ActionGameڵ ActionGameTests ģ飩
+ * κ RequestGameplayTag öļк
+ * 汾ûԴ룬
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGNoStringTagLookupsTest, "ActionGame.Tags.NoStringTagLookups",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGNoStringTagLookupsTest::RunTest(const FString& Parameters)
+{
+	const FString ModuleDir = FPaths::ConvertRelativePathToFull(FPaths::GameSourceDir() / TEXT("ActionGame"));
+	if (!IFileManager::Get().DirectoryExists(*ModuleDir))
+	{
+		AddWarning(FString::Printf(TEXT("Module source not found at %s, skipping"), *ModuleDir));
+		return true;
+	}
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *ModuleDir, TEXT("*.h"), true, false);
+	IFileManager::Get().FindFilesRecursive(Files, *ModuleDir, TEXT("*.cpp"), true, false, false);
+
+	int32 NumScanned = 0;
+	int32 NumLookups = 0;
+	for (const FString& File : Files)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *File))
+		{
+			AddWarning(FString::Printf(TEXT("Could not read %s"), *File));
+			continue;
+		}
+
+		++NumScanned;
+		for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+		{
+			if (Lines[LineIndex].Contains(TEXT("RequestGameplayTag")))
+			{
+				AddError(FString::Printf(TEXT("%s:%d uses a string tag lookup, declare the tag in AGGameplayTags instead"), *File, LineIndex + 1));
+				++NumLookups;
+			}
+		}
+	}
+
+	TestTrue(TEXT("Scanned module sources"), NumScanned > 0);
+	AddInfo(FString::Printf(TEXT("Scanned %d files, %d string tag lookups"), NumScanned, NumLookups));
+
+	return NumLookups == 0;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestAbilities.h"
+#include "AG_TestEffects.h"
+#include "AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
+
+UAG_TestAbility_CooldownAttack::UAG_TestAbility_CooldownAttack()
+{
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+	CooldownGameplayEffectClass = UAG_TestEffect_Cooldown::StaticClass();
+	DamageEffectClass = UAG_TestEffect_SourceScaledDamage::StaticClass();
+}
+
+void UAG_TestAbility_CooldownAttack::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
+{
+	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	LastDamageSpec = UAG_AbilitySystemComponentBase::MakeCachedOutgoingSpec(
+		ActorInfo->AbilitySystemComponent.Get(), DamageEffectClass, GetAbilityLevel(), MakeEffectContext(Handle, ActorInfo));
+
+	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
+}
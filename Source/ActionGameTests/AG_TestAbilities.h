@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GameplayAbility.h"
+#include "AG_TestAbilities.generated.h"
+
+/**
+ * Զõ Ability ࣬κʲ
+ */
+
+/** ύʱӦȴ GE MakeCachedOutgoingSpec ȡ˺ Spec/ļһ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestAbility_CooldownAttack : public UGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestAbility_CooldownAttack();
+
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
+
+	/** ˺ GEģ */
+	UPROPERTY()
+	TSubclassOf<UGameplayEffect> DamageEffectClass;
+
+	/** һμõ Spec */
+	FGameplayEffectSpecHandle LastDamageSpec;
+};
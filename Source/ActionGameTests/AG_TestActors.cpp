@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestActors.h"
+#include "AG_TestEffects.h"
+#include "Components/BoxComponent.h"
+#include "AbilitySystem/Components/InteractableComponent.h"
+
+AAG_TestLiteGroundShooter::AAG_TestLiteGroundShooter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer
+		.DoNotCreateDefaultSubobject(AbilitySystemComponentName)
+		.DoNotCreateDefaultSubobject(EnemyAttributeSetName))
+{
+	RewardEffectClass = UAG_TestEffect_Reward::StaticClass();
+}
+
+AAG_TestGroundShooter::AAG_TestGroundShooter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	RewardEffectClass = UAG_TestEffect_Reward::StaticClass();
+}
+
+AAG_TestInteractable::AAG_TestInteractable()
+{
+	Box = CreateDefaultSubobject<UBoxComponent>(TEXT("Box"));
+	Box->InitBoxExtent(FVector(50.f, 500.f, 500.f));
+	Box->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	Box->SetCollisionResponseToAllChannels(ECR_Block);
+	Box->ComponentTags.Add(InteractTags::InteractTarget);
+	RootComponent = Box;
+
+	Interactable = CreateDefaultSubobject<UInteractableComponent>(TEXT("Interactable"));
+}
@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Characters/EnemyGroundShooterCharacter.h"
+#include "ActionGameCharacter.h"
+#include "ActionGamePlayerController.h"
+#include "Interfaces/Interactable.h"
+#include "AG_TestActors.generated.h"
+
+/**
+ * Զõ Actor ࣬κʲ
+ */
+
+/** ˣص ASC / AttributeSet UAG_EnemyCombatComponent ӹ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API AAG_TestLiteGroundShooter : public AEnemyGroundShooterCharacter
+{
+	GENERATED_BODY()
+
+public:
+	AAG_TestLiteGroundShooter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+};
+
+/** ˣ GE ͬԱ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API AAG_TestGroundShooter : public AEnemyGroundShooterCharacter
+{
+	GENERATED_BODY()
+
+public:
+	AAG_TestGroundShooter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/** ӳɺFinishSpawning ǰ */
+	void SetInitEffectClass(TSubclassOf<UGameplayEffect> InEffectClass) { EnemyInitEffectClass = InEffectClass; }
+};
+
+/** ҽɫ Abstractɫɲͨ SetCharacterData д */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API AAG_TestPlayerCharacter : public AActionGameCharacter
+{
+	GENERATED_BODY()
+};
+
+/** ҿ¼յÿ Cue RPCִ Cue */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API AAG_TestPlayerController : public AActionGamePlayerController
+{
+	GENERATED_BODY()
+
+public:
+	virtual void ClientReceiveImpactCues_Implementation(const TArray<FImpactCueEvent>& Events) override
+	{
+		ImpactCueBatches.Add(Events);
+	}
+
+	/** ÿԪһ RPC Ĳ */
+	TArray<TArray<FImpactCueEvent>> ImpactCueBatches;
+};
+
+/** ɽĿ꣺һסͨ InteractTarget ǩĺӣעᵽ񣨰뾶 250¼Ĵ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API AAG_TestInteractable : public AActor, public IInteractable
+{
+	GENERATED_BODY()
+
+public:
+	AAG_TestInteractable();
+
+	virtual bool CanInteract_Implementation(AActor* Interactor) const override { return true; }
+	virtual void ExecuteInteract_Implementation(AActor* Interactor) override { ++NumInteracts; }
+	virtual EInteractType GetInteractType_Implementation() const override { return EInteractType::None; }
+	virtual float GetInteractCost_Implementation() const override { return 0.f; }
+
+	int32 NumInteracts = 0;
+
+protected:
+	UPROPERTY()
+	TObjectPtr<class UBoxComponent> Box;
+
+	UPROPERTY()
+	TObjectPtr<class UInteractableComponent> Interactable;
+};
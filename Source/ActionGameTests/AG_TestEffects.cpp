@@ -0,0 +1,142 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestEffects.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystem/AttributeSets/AG_AttributeSetBase.h"
+#include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
+
+UAG_TestEffect_SourceScaledDamage::UAG_TestEffect_SourceScaledDamage()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FAttributeBasedFloat SourceAttack;
+	SourceAttack.Coefficient = FScalableFloat(-1.f);
+	SourceAttack.BackingAttribute = FGameplayEffectAttributeCaptureDefinition(
+		UAG_EnemyAttributeSet::GetAttackPowerAttribute(), EGameplayEffectAttributeCaptureSource::Source, true);
+
+	FGameplayModifierInfo& Scaled = Modifiers.AddDefaulted_GetRef();
+	Scaled.Attribute = UAG_EnemyAttributeSet::GetHealthAttribute();
+	Scaled.ModifierOp = EGameplayModOp::Additive;
+	Scaled.ModifierMagnitude = FGameplayEffectModifierMagnitude(SourceAttack);
+
+	FSetByCallerFloat Damage;
+	Damage.DataTag = AGGameplayTags::Data_Damage;
+
+	FGameplayModifierInfo& ByCaller = Modifiers.AddDefaulted_GetRef();
+	ByCaller.Attribute = UAG_EnemyAttributeSet::GetHealthAttribute();
+	ByCaller.ModifierOp = EGameplayModOp::Additive;
+	ByCaller.ModifierMagnitude = FGameplayEffectModifierMagnitude(Damage);
+}
+
+UAG_TestEffect_SetByCallerDamage::UAG_TestEffect_SetByCallerDamage()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat Damage;
+	Damage.DataTag = AGGameplayTags::Data_Damage;
+
+	FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = UAG_EnemyAttributeSet::GetHealthAttribute();
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Damage);
+}
+
+UAG_TestEffect_Reward::UAG_TestEffect_Reward()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat Gold;
+	Gold.DataTag = AGGameplayTags::Data_Reward_Gold;
+
+	FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = UAG_EnemyAttributeSet::GetBountyGoldAttribute();
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Gold);
+}
+
+UAG_TestEffect_ItemFlat::UAG_TestEffect_ItemFlat()
+{
+	DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+	FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = UAG_EnemyAttributeSet::GetAttackPowerAttribute();
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(1.f));
+}
+
+UAG_TestEffect_ItemScaled::UAG_TestEffect_ItemScaled()
+{
+	DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+	FSetByCallerFloat Stack;
+	Stack.DataTag = AGGameplayTags::Data_Item_Stack;
+
+	FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = UAG_EnemyAttributeSet::GetAttackMultiplierAttribute();
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Stack);
+}
+
+UAG_TestEffect_ItemInstant::UAG_TestEffect_ItemInstant()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = UAG_EnemyAttributeSet::GetBountyGoldAttribute();
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(1.f));
+}
+
+UAG_TestEffect_EnemyInit::UAG_TestEffect_EnemyInit()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	auto AddInitModifier = [this](const FGameplayAttribute& Attribute, const FGameplayTag& DataTag)
+	{
+		FSetByCallerFloat Value;
+		Value.DataTag = DataTag;
+
+		FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute = Attribute;
+		Modifier.ModifierOp = EGameplayModOp::Override;
+		Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Value);
+	};
+
+	AddInitModifier(UAG_EnemyAttributeSet::GetMaxHealthAttribute(), AGGameplayTags::Data_Init_MaxHealth);
+	AddInitModifier(UAG_EnemyAttributeSet::GetHealthAttribute(), AGGameplayTags::Data_Init_Health);
+	AddInitModifier(UAG_EnemyAttributeSet::GetAttackPowerAttribute(), AGGameplayTags::Data_Init_AttackPower);
+	AddInitModifier(UAG_EnemyAttributeSet::GetAttackMultiplierAttribute(), AGGameplayTags::Data_Init_AttackMultiplier);
+	AddInitModifier(UAG_EnemyAttributeSet::GetBountyGoldAttribute(), AGGameplayTags::Data_Init_BountyGold);
+}
+
+UAG_TestEffect_EnemyInitWithBonus::UAG_TestEffect_EnemyInitWithBonus()
+{
+	FGameplayModifierInfo& Bonus = Modifiers.AddDefaulted_GetRef();
+	Bonus.Attribute = UAG_EnemyAttributeSet::GetAttackPowerAttribute();
+	Bonus.ModifierOp = EGameplayModOp::Additive;
+	Bonus.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(5.f));
+}
+
+UAG_TestEffect_Startup::UAG_TestEffect_Startup()
+{
+	DurationPolicy = EGameplayEffectDurationType::Infinite;
+}
+
+UAG_TestEffect_PlayerInit::UAG_TestEffect_PlayerInit()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	for (const FGameplayAttribute& Attribute : { UAG_AttributeSetBase::GetMaxHealthAttribute(), UAG_AttributeSetBase::GetHealthAttribute() })
+	{
+		FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute = Attribute;
+		Modifier.ModifierOp = EGameplayModOp::Override;
+		Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(100.f));
+	}
+}
+
+UAG_TestEffect_Cooldown::UAG_TestEffect_Cooldown()
+{
+	DurationPolicy = EGameplayEffectDurationType::HasDuration;
+	DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(1.f));
+}
@@ -0,0 +1,123 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "AG_TestEffects.generated.h"
+
+/**
+ * Զõ GE 
+ * - MakeOutgoingSpec ֻ GE ࣬ʱ NewObject  GE ߻/·
+ * - κʲHideDropdown ڱ༭ѡб
+ */
+
+/** ˲ʱ˺Health -= Դ AttackPowerղ񣩣 SetByCaller Data.Damage */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_SourceScaledDamage : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_SourceScaledDamage();
+};
+
+/** ˲ʱ˺Health += SetByCaller Data.DamageκԣԴã */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_SetByCallerDamage : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_SetByCallerDamage();
+};
+
+/** ˲ʱBountyGold += SetByCaller Data.Reward.Goldɱõ˴ң */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_Reward : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_Reward();
+};
+
+/** Ʒ GEʽ AttackPower +1ȡ Data.Item.StackÿƷһʵ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_ItemFlat : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_ItemFlat();
+};
+
+/** Ʒ GEţ AttackMultiplier += Data.Item.Stackֻһʵ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_ItemScaled : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_ItemScaled();
+};
+
+/** Ʒ GEʽƷ˲ʱ BountyGold +1 */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_ItemInstant : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_ItemInstant();
+};
+
+/**  Init GE˲ʱData.Init.* ԣֱд BaseValue ȼ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_EnemyInit : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_EnemyInit();
+};
+
+/**  Init GE һ AttackPower +5ֱдֵ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_EnemyInitWithBonus : public UAG_TestEffect_EnemyInit
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_EnemyInitWithBonus();
+};
+
+/** ε GEֻʵɫЧ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_Startup : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_Startup();
+};
+
+/** Գʼ˲ʱ Override MaxHealth / Health = 100ɫĳʼ GE һ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_PlayerInit : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_PlayerInit();
+};
+
+/** ȴ GE1 ΣͼύʱȴһֻһЧ */
+UCLASS(NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestEffect_Cooldown : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UAG_TestEffect_Cooldown();
+};
@@ -0,0 +1,20 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestNet.h"
+
+bool UAG_TestPackageMap::SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID)
+{
+	uint32 Index = 0;
+	if (Ar.IsSaving() && Obj)
+	{
+		Index = Objects.AddUnique(Obj) + 1;
+	}
+
+	Ar.SerializeIntPacked(Index);
+
+	if (Ar.IsLoading())
+	{
+		Obj = Objects.IsValidIndex(static_cast<int32>(Index) - 1) ? Objects[Index - 1].Get() : nullptr;
+	}
+	return true;
+}
@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/CoreNet.h"
+#include "AG_TestNet.generated.h"
+
+/**
+ * Զõ PackageMapҪ NetDriver / 
+ * ð packed int д루0 Ϊգʵ NetGUID һпͬһʵʱԭ
+ * ڲȽϲͬʽλָʽͬһʵɹƽȽ
+ */
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class ACTIONGAMETESTS_API UAG_TestPackageMap : public UPackageMap
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID = nullptr) override;
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> Objects;
+};
@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/WorldSettings.h"
+#include "GameplayEffect.h"
+#include "UObject/Package.h"
+#include "ActionGamePlayerState.h"
+
+/**
+ * Զõʱ Game World
+ * - Standaloneû GameModeַֻ BeginPlayActionGame  World ϵͳճ
+ * - Tick ͬʱ World ϵͳͶʱ
+ */
+class FAGTestWorld
+{
+public:
+	FAGTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("AGTestWorld"));
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->GetWorldSettings()->NotifyBeginPlay();
+	}
+
+	~FAGTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	UWorld* Get() const { return World; }
+
+	void Tick(float DeltaTime = 1.f / 60.f)
+	{
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+	/** Tick һ֡غʱ룩 */
+	double TickTimed(float DeltaTime = 1.f / 60.f)
+	{
+		const double Start = FPlatformTime::Seconds();
+		Tick(DeltaTime);
+		return (FPlatformTime::Seconds() - Start) * 1000.0;
+	}
+
+	template<class T>
+	T* Spawn(UClass* Class, const FVector& Location = FVector::ZeroVector)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActor<T>(Class, Location, FRotator::ZeroRotator, Params);
+	}
+
+	template<class T>
+	T* Spawn(const FVector& Location = FVector::ZeroVector)
+	{
+		return Spawn<T>(T::StaticClass(), Location);
+	}
+
+private:
+	UWorld* World = nullptr;
+};
+
+namespace AGTest
+{
+	/** ʱ˲ʱ GE Attribute һ Additive ޸ */
+	inline UGameplayEffect* MakeInstantAddEffect(const FGameplayAttribute& Attribute, float Magnitude, FName Name = NAME_None)
+	{
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), Name);
+		Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+		FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute = Attribute;
+		Modifier.ModifierOp = EGameplayModOp::Additive;
+		Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(Magnitude));
+
+		return Effect;
+	}
+
+	/**
+	 *  World û GameModeController Զ PlayerState
+	 * ҽɫ ASC  AActionGamePlayerState ϣPossess ǰ AActionGameGameMode  PlayerStateClass һ
+	 */
+	inline AActionGamePlayerState* GivePlayerState(AController* Controller)
+	{
+		if (!Controller)
+		{
+			return nullptr;
+		}
+
+		if (AActionGamePlayerState* Existing = Controller->GetPlayerState<AActionGamePlayerState>())
+		{
+			return Existing;
+		}
+
+		FActorSpawnParameters Params;
+		Params.Owner = Controller;
+		Params.ObjectFlags |= RF_Transient;
+
+		AActionGamePlayerState* PlayerState = Controller->GetWorld()->SpawnActor<AActionGamePlayerState>(Params);
+		Controller->SetPlayerState(PlayerState);
+		return PlayerState;
+	}
+
+	/** Դ 1m 尴 Scale ɵ赲飨 / ǽ / ̨ףBlockAllԴȱʧʱؿ */
+	inline AStaticMeshActor* SpawnBlock(UWorld* World, const FVector& Location, const FVector& Scale)
+	{
+		UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+		if (!World || !Cube)
+		{
+			return nullptr;
+		}
+
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		const FTransform Transform(FQuat::Identity, Location, Scale);
+		AStaticMeshActor* Block = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Transform, Params);
+		if (Block)
+		{
+			UStaticMeshComponent* Mesh = Block->GetStaticMeshComponent();
+			Mesh->SetMobility(EComponentMobility::Movable);
+			Mesh->SetStaticMesh(Cube);
+			Mesh->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		}
+		return Block;
+	}
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,204 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "ActionGameplayTags.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/Abilities/GA_PrimaryAttack.h"
+#include "AbilitySystem/Abilities/GA_SecondAttack.h"
+#include "AbilitySystem/AttributeSets/AG_EnemyAttributeSet.h"
+#include "Characters/EnemyGroundShooterCharacter.h"
+#include "Subsystems/AG_AreaDamageSubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "AG_TestActors.h"
+
+/**
+ * Ŀ
+ *  UGA_SecondAttack::FireChainShot  3) 4) ͬһ GatherTargets + SelectChainHops + һ Spec Ӧ
+ * ÿĿƽµĵĿ꿪ӦԸ
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGSecondAttackChainCostTest, "ActionGame.Weapon.SecondAttackChainCost",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGSecondAttackChainCostTest::RunTest(const FString& Parameters)
+{
+	constexpr float Spacing = 300.f;
+	constexpr float ChainRange = 800.f;
+	constexpr int32 Iterations = 20;
+	const int32 TargetCounts[] = { 5, 20, 80, 320 };
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	UAG_AreaDamageSubsystem* AreaDamage = World->GetSubsystem<UAG_AreaDamageSubsystem>();
+	if (!TestNotNull(TEXT("AreaDamage subsystem"), AreaDamage))
+	{
+		return false;
+	}
+
+	// һŵˣڼСڵ룬һ·
+	const int32 MaxTargets = TargetCounts[UE_ARRAY_COUNT(TargetCounts) - 1];
+	TArray<AEnemyCharacterBase*> Enemies;
+	for (int32 Index = 0; Index < MaxTargets; ++Index)
+	{
+		AEnemyCharacterBase* Enemy = TestWorld.Spawn<AEnemyGroundShooterCharacter>(FVector(Spacing * Index, 0.f, 100.f));
+		if (!Enemy || !Enemy->GetAbilitySystemComponent())
+		{
+			AddError(TEXT("Failed to spawn an enemy with an ASC"));
+			return false;
+		}
+
+		UAbilitySystemComponent* ASC = Enemy->GetAbilitySystemComponent();
+		ASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetMaxHealthAttribute(), 1.e9f);
+		ASC->SetNumericAttributeBase(UAG_EnemyAttributeSet::GetHealthAttribute(), 1.e9f);
+		Enemies.Add(Enemy);
+	}
+
+	TestWorld.Tick();
+
+	UAbilitySystemComponent* SourceASC = Enemies[0]->GetAbilitySystemComponent();
+	UGameplayEffect* DamageEffect = AGTest::MakeInstantAddEffect(UAG_EnemyAttributeSet::GetHealthAttribute(), -1.f, TEXT("GE_Test_ChainDamage"));
+	const FVector ChainStart(-Spacing, 0.f, 100.f);
+
+	double FirstCostPerHitUs = 0.0;
+	double LastCostPerHitUs = 0.0;
+
+	for (const int32 NumTargets : TargetCounts)
+	{
+		double TotalMs = 0.0;
+		int32 NumHit = 0;
+
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double Start = FPlatformTime::Seconds();
+
+			TArray<UAbilitySystemComponent*> Candidates;
+			AreaDamage->GatherTargets(ChainStart, Spacing * (NumTargets + 1), nullptr, AEnemyCharacterBase::StaticClass(), AGGameplayTags::State_Dead, Candidates);
+
+			TArray<FAGChainCandidate> Pending;
+			Pending.Reserve(Candidates.Num());
+			for (UAbilitySystemComponent* Candidate : Candidates)
+			{
+				AActor* Avatar = Candidate->GetAvatarActor();
+				Pending.Add({ Avatar, Candidate, nullptr, Avatar->GetActorLocation() });
+			}
+
+			TArray<FAGChainCandidate> Hops;
+			UGA_SecondAttack::SelectChainHops(ChainStart, ChainRange, NumTargets, Pending, Hops);
+
+			TArray<UAbilitySystemComponent*> Targets;
+			for (const FAGChainCandidate& Hop : Hops)
+			{
+				Targets.Add(Hop.ASC);
+			}
+
+			const FGameplayEffectSpec Spec(DamageEffect, SourceASC->MakeEffectContext(), 1.f);
+			NumHit = UAG_AreaDamageSubsystem::ApplySpecToTargets(SourceASC, Spec, Targets);
+
+			TotalMs += (FPlatformTime::Seconds() - Start) * 1000.0;
+		}
+
+		TestEqual(*FString::Printf(TEXT("Targets hit with %d in range"), NumTargets), NumHit, NumTargets);
+
+		const double AverageMs = TotalMs / Iterations;
+		const double CostPerHitUs = AverageMs * 1000.0 / FMath::Max(1, NumHit);
+		AddInfo(FString::Printf(TEXT("SecondAttack chain: %3d hits, %.3f ms per activation, %.2f us per target"),
+			NumHit, AverageMs, CostPerHitUs));
+
+		if (FirstCostPerHitUs <= 0.0)
+		{
+			FirstCostPerHitUs = CostPerHitUs;
+		}
+		LastCostPerHitUs = CostPerHitUs;
+	}
+
+	// Ŀ꿪³ƽʱܻӰ죬ֻ治ʧ
+	if (LastCostPerHitUs > FirstCostPerHitUs * 3.0)
+	{
+		AddWarning(FString::Printf(TEXT("Per-target chain cost grew from %.2f us to %.2f us"), FirstCostPerHitUs, LastCostPerHitUs));
+	}
+
+	return true;
+}
+
+/**
+ * £C++ Ŀ BP_GA_PrimaryAttack Ա
+ * ÿμȴȡ AbilityǼ +  + 
+ * BP_GA_PrimaryAttack Ǩǰû FireMontageNativeFlow 1 ʱҲ߾ͼͼ
+ * ҲͼԴʱֻ C++ 
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGPrimaryAttackActivationRateTest, "ActionGame.Weapon.PrimaryAttackActivationRate",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGPrimaryAttackActivationRateTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumActivations = 500;
+
+	IConsoleVariable* NativeFlowCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ag.PrimaryAttack.NativeFlow"));
+	if (!TestNotNull(TEXT("ag.PrimaryAttack.NativeFlow"), NativeFlowCVar))
+	{
+		return false;
+	}
+	const int32 SavedNativeFlow = NativeFlowCVar->GetInt();
+
+	FAGTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	APlayerController* Controller = World->SpawnActor<APlayerController>();
+	AAG_TestPlayerCharacter* Character = TestWorld.Spawn<AAG_TestPlayerCharacter>(FVector(0.f, 0.f, 100.f));
+	if (!TestNotNull(TEXT("Player controller"), Controller) || !TestNotNull(TEXT("Player character"), Character))
+	{
+		return false;
+	}
+	AGTest::GivePlayerState(Controller);
+	Controller->Possess(Character);
+
+	UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+	const FGameplayTagContainer CooldownTags(AGGameplayTags::Cooldown_PrimaryAttack);
+
+	auto Measure = [&](UClass* AbilityClass, int32 NativeFlow, const TCHAR* Label)
+	{
+		NativeFlowCVar->Set(NativeFlow, ECVF_SetByCode);
+		const FGameplayAbilitySpecHandle Handle = ASC->GiveAbility(FGameplayAbilitySpec(AbilityClass, 1));
+
+		int32 NumActivated = 0;
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumActivations; ++Index)
+		{
+			ASC->RemoveActiveEffectsWithGrantedTags(CooldownTags);
+			if (ASC->TryActivateAbility(Handle))
+			{
+				++NumActivated;
+			}
+			ASC->CancelAbilityHandle(Handle);
+		}
+		const double Seconds = FPlatformTime::Seconds() - Start;
+
+		ASC->ClearAbility(Handle);
+
+		AddInfo(FString::Printf(TEXT("%s: %d/%d activated, %.0f activations per second"),
+			Label, NumActivated, NumActivations, NumActivations / FMath::Max(Seconds, UE_DOUBLE_SMALL_NUMBER)));
+		return NumActivated;
+	};
+
+	TestEqual(TEXT("C++ flow activations"), Measure(UGA_PrimaryAttack::StaticClass(), 1, TEXT("C++ flow")), NumActivations);
+
+	if (UClass* BlueprintClass = LoadClass<UGA_PrimaryAttack>(nullptr, TEXT("/Game/Blueprints/AbilitySystem/Abilities/BP_GA_PrimaryAttack.BP_GA_PrimaryAttack_C")))
+	{
+		Measure(BlueprintClass, 0, TEXT("BP_GA_PrimaryAttack, NativeFlow 0"));
+		Measure(BlueprintClass, 1, TEXT("BP_GA_PrimaryAttack, NativeFlow 1 (legacy graph until migrated)"));
+	}
+	else
+	{
+		AddWarning(TEXT("BP_GA_PrimaryAttack not found, only the C++ flow was measured"));
+	}
+
+	NativeFlowCVar->Set(SavedNativeFlow, ECVF_SetByCode);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,201 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AG_TestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "EngineUtils.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Actors/WorldItemActor.h"
+#include "DataAssets/DA_Item.h"
+#include "Subsystems/AG_WorldItemFieldSubsystem.h"
+
+namespace AGWorldItemTests
+{
+	constexpr int32 NumItems = 1000;
+	constexpr int32 GridWidth = 40;
+	constexpr float Spacing = 250.f;
+	constexpr int32 NumTicks = 120;
+
+	/** ڼд CVarʱԭ */
+	struct FScopedCVar
+	{
+		FScopedCVar(const TCHAR* Name)
+			: CVar(IConsoleManager::Get().FindConsoleVariable(Name))
+		{
+			if (CVar)
+			{
+				Saved = CVar->GetString();
+			}
+		}
+
+		~FScopedCVar()
+		{
+			if (CVar)
+			{
+				CVar->Set(*Saved, ECVF_SetByCode);
+			}
+		}
+
+		void Set(float Value)
+		{
+			if (CVar)
+			{
+				CVar->Set(Value, ECVF_SetByCode);
+			}
+		}
+
+		IConsoleVariable* CVar = nullptr;
+		FString Saved;
+	};
+
+	int32 CountItemActors(UWorld* World)
+	{
+		int32 Count = 0;
+		for (TActorIterator<AWorldItemActor> It(World); It; ++It)
+		{
+			++Count;
+		}
+		return Count;
+	}
+
+	int32 CountReplicatedActors(UWorld* World)
+	{
+		int32 Count = 0;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			if (It->GetIsReplicated())
+			{
+				++Count;
+			}
+		}
+		return Count;
+	}
+}
+
+/**
+ * 1000 ɢ Actorag.WorldItems.Field 0ʵ Field Ա
+ * - ¼ɺʱ AWorldItemActor / Ҫͬ Actor ÿ֡ Tick ʱ
+ * - Fieldҽ丽ƷΪ Actor Field
+ * - ͻأվ뾶뽵뾶֮ʱƷֲԶ DemoteDelay ȫ Field
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGWorldItemFieldTest, "ActionGame.WorldItems.FieldThousandItems",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGWorldItemFieldTest::RunTest(const FString& Parameters)
+{
+	using namespace AGWorldItemTests;
+
+	FScopedCVar FieldCVar(TEXT("ag.WorldItems.Field"));
+	FScopedCVar UpdateRateCVar(TEXT("ag.WorldItems.UpdateRate"));
+	FScopedCVar DemoteDelayCVar(TEXT("ag.WorldItems.DemoteDelay"));
+	FScopedCVar PromoteRadiusCVar(TEXT("ag.WorldItems.PromoteRadius"));
+	FScopedCVar DemoteMarginCVar(TEXT("ag.WorldItems.DemoteMargin"));
+	if (!TestNotNull(TEXT("ag.WorldItems.Field"), FieldCVar.CVar) || !TestNotNull(TEXT("ag.WorldItems.DemoteDelay"), DemoteDelayCVar.CVar)
+		|| !TestNotNull(TEXT("ag.WorldItems.PromoteRadius"), PromoteRadiusCVar.CVar) || !TestNotNull(TEXT("ag.WorldItems.DemoteMargin"), DemoteMarginCVar.CVar))
+	{
+		return false;
+	}
+
+	// ÿ֡飬̽ȴ
+	UpdateRateCVar.Set(0.f);
+	DemoteDelayCVar.Set(0.5f);
+
+	const float PromoteRadius = PromoteRadiusCVar.CVar->GetFloat();
+	const float DemoteRadius = PromoteRadius + DemoteMarginCVar.CVar->GetFloat();
+
+	UDA_Item* Item = NewObject<UDA_Item>(GetTransientPackage());
+	Item->WorldMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+
+	for (const int32 bField : { 0, 1 })
+	{
+		FieldCVar.Set(bField);
+
+		FAGTestWorld TestWorld;
+		UWorld* World = TestWorld.Get();
+		UAG_WorldItemFieldSubsystem* ItemField = World->GetSubsystem<UAG_WorldItemFieldSubsystem>();
+
+		APlayerController* Controller = World->SpawnActor<APlayerController>();
+		ADefaultPawn* Pawn = TestWorld.Spawn<ADefaultPawn>(FVector(0.f, 0.f, 100.f));
+		if (!TestNotNull(TEXT("Item field subsystem"), ItemField) || !TestNotNull(TEXT("Player controller"), Controller)
+			|| !TestNotNull(TEXT("Player pawn"), Pawn))
+		{
+			return false;
+		}
+		Controller->Possess(Pawn);
+
+		const int32 BaseReplicated = CountReplicatedActors(World);
+
+		const double SpawnStart = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			const FVector Location((Index % GridWidth) * Spacing, (Index / GridWidth) * Spacing, 50.f);
+			ItemField->SpawnItem(Item, Location, AWorldItemActor::StaticClass());
+		}
+		const double SpawnMs = (FPlatformTime::Seconds() - SpawnStart) * 1000.0;
+
+		double TickMs = 0.0;
+		for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+		{
+			TickMs += TestWorld.TickTimed();
+		}
+
+		const int32 NumActors = CountItemActors(World);
+		AddInfo(FString::Printf(TEXT("Field %d: spawn %.2f ms, %d item actors, %d extra replicated actors, %.3f ms per tick"),
+			bField, SpawnMs, NumActors, CountReplicatedActors(World) - BaseReplicated, TickMs / NumTicks));
+
+		if (!bField)
+		{
+			TestEqual(TEXT("Without the field every item is an actor"), NumActors, NumItems);
+			continue;
+		}
+
+		TestEqual(TEXT("Every item is resting or promoted"), ItemField->GetNumResting() + ItemField->GetNumPromoted(), NumItems);
+		TestEqual(TEXT("Only promoted items are actors"), NumActors, ItemField->GetNumPromoted());
+		TestTrue(TEXT("Items near the player are promoted"), ItemField->GetNumPromoted() > 0);
+		TestTrue(TEXT("Most items stay in the field"), ItemField->GetNumPromoted() < NumItems / 10);
+
+		// վ뾶뽵뾶֮䣺ԭƷΪ Actor뾶Ʒ
+		TWeakObjectPtr<AWorldItemActor> OriginItem;
+		for (TActorIterator<AWorldItemActor> It(World); It; ++It)
+		{
+			if (It->GetActorLocation().Equals(FVector(0.f, 0.f, 50.f), 1.f))
+			{
+				OriginItem = *It;
+			}
+		}
+		TestTrue(TEXT("The item at the player's feet is promoted"), OriginItem.IsValid());
+
+		Pawn->SetActorLocation(FVector(-0.5f * (PromoteRadius + DemoteRadius), 0.f, 50.f));
+		const int32 PromotedBefore = ItemField->GetNumPromoted();
+		for (int32 Tick = 0; Tick < 60; ++Tick)
+		{
+			TestWorld.Tick();
+		}
+		TestTrue(TEXT("Hysteresis keeps the item between the radii promoted"), OriginItem.IsValid());
+		TestTrue(TEXT("Items beyond the demote radius return to the field"), ItemField->GetNumPromoted() < PromotedBefore);
+
+		// Զ DemoteDelay ȫص Field
+		Pawn->SetActorLocation(FVector(-100000.f, -100000.f, 100.f));
+		for (int32 Tick = 0; Tick < 60; ++Tick)
+		{
+			TestWorld.Tick();
+		}
+		TestEqual(TEXT("Distant items demote"), ItemField->GetNumPromoted(), 0);
+		TestEqual(TEXT("Demoted items are resting again"), ItemField->GetNumResting(), NumItems);
+		TestEqual(TEXT("No item actors remain"), CountItemActors(World), 0);
+
+		// 
+		Pawn->SetActorLocation(FVector(0.f, 0.f, 100.f));
+		TestWorld.Tick();
+		TestEqual(TEXT("Returning promotes the same items again"), ItemField->GetNumPromoted(), PromotedBefore);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
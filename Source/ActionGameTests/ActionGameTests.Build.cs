@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+using UnrealBuildTool;
+
+// ԶԺͲרõࣨGE / Actor / PackageMapֻڱ༭ﹹ
+public class ActionGameTests : ModuleRules
+{
+	public ActionGameTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"NetCore",
+			"AIModule",
+			"PhysicsCore",
+			"GameplayAbilities",
+			"GameplayTags",
+			"GameplayTasks",
+			"ActionGame"
+		});
+
+		PrivateIncludePaths.Add(ModuleDirectory);
+	}
+}